@@ -1,19 +1,52 @@
 #include "ArrayParser.hpp"
+#include "cpu_dispatch.hpp"
 
-bool ArrayParser::parse(std::vector<std::string>& out) {
-    Token t = tokenizer.next();
-    if (t.type != TokenType::ArrayStart) return false;
+namespace ArrayScan {
 
-    while (true) {
-        Token val = tokenizer.next();
-        if (val.type == TokenType::ArrayEnd) break;
-        if (val.type != TokenType::String) return false;
+namespace {
 
-        out.emplace_back(val.value);
+size_t countCommasScalar(const char* data, size_t size) {
+    size_t commas = 0;
+    for (size_t i = 0; i < size; ++i) {
+        commas += data[i] == ',';
+    }
+    return commas;
+}
+
+#ifdef CPU_DISPATCH_X86
+
+size_t countCommasSse2(const char* data, size_t size) {
+    const __m128i comma = _mm_set1_epi8(',');
+    size_t commas = 0;
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        commas += std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, comma))));
+    }
+    return commas + countCommasScalar(data + i, size - i);
+}
 
-        Token next = tokenizer.next();
-        if (next.type == TokenType::ArrayEnd) break;
-        if (next.type != TokenType::Comma) return false;
+CPU_DISPATCH_TARGET_AVX2 size_t countCommasAvx2(const char* data, size_t size) {
+    const __m256i comma = _mm256_set1_epi8(',');
+    size_t commas = 0;
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        commas += std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, comma))));
     }
-    return true;
+    return commas + countCommasScalar(data + i, size - i);
 }
+
+#endif
+
+} // namespace
+
+size_t countCommas(std::string_view text) {
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) return countCommasAvx2(text.data(), text.size());
+        if (CpuDispatch::activeIsa() >= CpuDispatch::Isa::Sse2) return countCommasSse2(text.data(), text.size());
+    #endif
+    return countCommasScalar(text.data(), text.size());
+}
+
+} // namespace ArrayScan
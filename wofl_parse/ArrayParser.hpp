@@ -1,14 +1,223 @@
 #pragma once
-#include "Tokenizer.hpp"
-#include <vector>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "json_number.hpp"
+#include "json_string.hpp"
+#include "utf8_validate.hpp"
+
+// Scanning helpers shared by every ArrayParser<T>
+namespace ArrayScan {
+
+// Number of ',' bytes in text (SIMD). Used as a reserve hint, so commas
+// inside strings or nested arrays only make the hint generous.
+size_t countCommas(std::string_view text);
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline void skipWhitespace(std::string_view src, size_t& pos) {
+    while (pos < src.size() && (src[pos] == ' ' || src[pos] == '\t' || src[pos] == '\n' || src[pos] == '\r')) {
+        ++pos;
+    }
+}
+
+// True if all eight bytes at p are ASCII digits
+inline bool isEightDigits(const char* p) {
+    uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL)
+          | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// Value of eight ASCII digits, three multiplies instead of eight (SWAR)
+inline uint32_t parseEightDigits(const char* p) {
+    uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+    chunk = (chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561 >> 8;
+    chunk = (chunk & 0x00FF00FF00FF00FFULL) * 6553601 >> 16;
+    return static_cast<uint32_t>((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL >> 32);
+}
+
+// Unsigned magnitude of the digit run at src[pos]. Fails on no digits, a
+// leading zero followed by more digits, or a value past UINT64_MAX.
+inline bool parseMagnitude(std::string_view src, size_t& pos, uint64_t& magnitude) {
+    size_t start = pos;
+    uint64_t value = 0;
+
+    // At most 16 digits here, so this part cannot overflow
+    if constexpr (std::endian::native == std::endian::little) {
+        while (pos + 8 <= src.size() && pos - start < 16 && isEightDigits(src.data() + pos)) {
+            value = value * 100000000 + parseEightDigits(src.data() + pos);
+            pos += 8;
+        }
+    }
+    while (pos < src.size() && isDigit(src[pos])) {
+        uint64_t digit = static_cast<uint64_t>(src[pos] - '0');
+        // Only the 20th digit onwards can overflow
+        if (pos - start >= 19 && value > (std::numeric_limits<uint64_t>::max() - digit) / 10) return false;
+        value = value * 10 + digit;
+        ++pos;
+    }
+
+    size_t digits = pos - start;
+    if (digits == 0) return false;
+    if (src[start] == '0' && digits > 1) return false;
+    magnitude = value;
+    return true;
+}
+
+} // namespace ArrayScan
 
+// Parses one JSON array of numbers, bools or strings into contiguous storage.
+// T is any arithmetic type (bool included) or std::string. Elements of any
+// other type - including null and nested containers - make parse() fail, as
+// does anything but whitespace after the closing ']'. Numbers follow the JSON
+// grammar (JsonNumber) and must fit T; strings are unescaped. On failure the
+// output holds what it held before. src must outlive the parser.
+template <typename T>
 class ArrayParser {
+    static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, std::string>,
+                  "ArrayParser<T>: T must be a number, bool or std::string");
+
 public:
-    ArrayParser(std::string_view src) : tokenizer(src) {}
+    ArrayParser(std::string_view src) : src(src) {}
+
+    // Appends every element to out; on failure out is cut back to its old size
+    bool parse(std::vector<T>& out) {
+        size_t original_size = out.size();
+        out.reserve(out.size() + ArrayScan::countCommas(src) + 1);
+        bool ok = parseElements([&](T& value) {
+            out.push_back(std::move(value));
+            return true;
+        });
+        if (!ok) out.resize(original_size);
+        return ok;
+    }
 
-    bool parse(std::vector<std::string>& out);
+    // Fills out from the front; count is how many elements were written, and
+    // 0 on failure. Fails if the array holds more elements than out has room for.
+    bool parse(std::span<T> out, size_t& count) {
+        count = 0;
+        bool ok = parseElements([&](T& value) {
+            if (count == out.size()) return false;
+            out[count++] = std::move(value);
+            return true;
+        });
+        if (!ok) count = 0;
+        return ok;
+    }
 
 private:
-    Tokenizer tokenizer;
+    std::string_view src;
+    std::vector<char> unescaped;   // scratch for strings with escapes
+
+    template <typename Emit>
+    bool parseElements(Emit&& emit) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (!Utf8::validate(src)) return false;
+        }
+
+        size_t pos = 0;
+        ArrayScan::skipWhitespace(src, pos);
+        if (pos >= src.size() || src[pos] != '[') return false;
+        ++pos;
+
+        ArrayScan::skipWhitespace(src, pos);
+        if (pos < src.size() && src[pos] == ']') return onlyWhitespaceAfter(pos + 1);
+
+        while (true) {
+            ArrayScan::skipWhitespace(src, pos);
+            T value{};
+            if (!parseValue(pos, value) || !emit(value)) return false;
+
+            ArrayScan::skipWhitespace(src, pos);
+            if (pos >= src.size()) return false;
+            if (src[pos] == ']') return onlyWhitespaceAfter(pos + 1);
+            if (src[pos] != ',') return false;
+            ++pos;
+        }
+    }
+
+    bool onlyWhitespaceAfter(size_t pos) const {
+        ArrayScan::skipWhitespace(src, pos);
+        return pos == src.size();
+    }
+
+    bool parseValue(size_t& pos, T& out) {
+        if constexpr (std::is_same_v<T, bool>) {
+            std::string_view rest = src.substr(pos);
+            if (rest.substr(0, 4) == "true") {
+                pos += 4;
+                out = true;
+                return true;
+            }
+            if (rest.substr(0, 5) == "false") {
+                pos += 5;
+                out = false;
+                return true;
+            }
+            return false;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (pos >= src.size() || src[pos] != '"') return false;
+            size_t start = pos + 1;
+            size_t end = start;
+            while (end < src.size() && src[end] != '"') {
+                end += src[end] == '\\' ? 2 : 1;
+            }
+            if (end >= src.size()) return false;
+
+            std::string_view raw = src.substr(start, end - start);
+            if (JsonString::findSpecial(raw) == raw.size()) {
+                out.assign(raw);
+            } else {
+                unescaped.clear();
+                if (JsonString::unescapeInto(raw, unescaped) != raw.size()) return false;
+                out.assign(unescaped.data(), unescaped.size());
+            }
+            pos = end + 1;
+            return true;
+        } else if constexpr (std::is_integral_v<T>) {
+            bool negative = pos < src.size() && src[pos] == '-';
+            if (negative) ++pos;
+
+            uint64_t magnitude = 0;
+            if (!ArrayScan::parseMagnitude(src, pos, magnitude)) return false;
+            // A fraction or exponent is not an integer
+            if (pos < src.size() && (src[pos] == '.' || src[pos] == 'e' || src[pos] == 'E')) return false;
+
+            if (negative) {
+                if constexpr (std::is_unsigned_v<T>) {
+                    if (magnitude != 0) return false;
+                    out = 0;
+                } else {
+                    uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + 1;
+                    if (magnitude > limit) return false;
+                    out = static_cast<T>(0 - static_cast<std::make_unsigned_t<T>>(magnitude));
+                }
+            } else {
+                if (magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max())) return false;
+                out = static_cast<T>(magnitude);
+            }
+            return true;
+        } else {
+            // Check the grammar first: from_chars would also take "01" and "1."
+            bool integral = false;
+            size_t length = JsonNumber::scan(src.substr(pos), integral);
+            if (length == 0) return false;
+
+            const char* last = src.data() + pos + length;
+            auto [end, error] = std::from_chars(src.data() + pos, last, out);
+            if (error != std::errc{} || end != last) return false;
+            pos += length;
+            return true;
+        }
+    }
 };
@@ -0,0 +1,332 @@
+#ifndef ASYNC_LOGGER_HPP
+#define ASYNC_LOGGER_HPP
+
+// 📝 Asynchronous console sink for per-beacon output
+// - Each thread formats into its own reusable ostream (no locks, no allocation
+//   once warm) and commits the finished record to its own lock-free SPSC ring
+// - A background flusher drains every ring and writes with one fwrite per pass
+// - Wall-clock prefixes are formatted once per second per thread and use
+//   localtime_r/localtime_s, so they are safe to call from any thread
+// - Optional rate limit (records/second); excess records are counted and
+//   reported as one "suppressed" line instead of being formatted
+// A full ring drops the record (counted) rather than blocking the caller.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace AsyncLog {
+
+// 🕰️ Thread-safe local time (std::localtime shares one static buffer)
+inline std::tm localTime(std::time_t t) {
+    std::tm tm{};
+    #ifdef _WIN32
+        localtime_s(&tm, &t);
+    #else
+        localtime_r(&t, &tm);
+    #endif
+    return tm;
+}
+
+// "YYYY-MM-DD HH:MM:SS" for an arbitrary timestamp (e.g. a beacon's own)
+inline std::string formatDateTime(std::time_t t) {
+    std::tm tm = localTime(t);
+    char text[32];
+    size_t length = std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &tm);
+    return std::string(text, length);
+}
+
+// "HH:MM:SS" for now, re-formatted only when the second changes
+inline std::string_view clockText() {
+    thread_local std::time_t cached_second{ -1 };
+    thread_local std::array<char, 16> cached_text{};
+    thread_local size_t cached_length{ 0 };
+    
+    std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    if (now != cached_second) {
+        std::tm tm = localTime(now);
+        cached_length = std::strftime(cached_text.data(), cached_text.size(), "%H:%M:%S", &tm);
+        cached_second = now;
+    }
+    return { cached_text.data(), cached_length };
+}
+
+// 🔁 Single-producer/single-consumer byte ring of length-prefixed records
+class RecordRing {
+private:
+    static constexpr size_t capacity = 256 * 1024;
+    
+    std::unique_ptr<char[]> bytes{ std::make_unique<char[]>(capacity) };
+    alignas(64) std::atomic<size_t> head{ 0 };    // consumer position
+    alignas(64) std::atomic<size_t> tail{ 0 };    // producer position
+    
+    void copyIn(size_t pos, const void* src, size_t length) {
+        size_t offset = pos % capacity;
+        size_t first = std::min(length, capacity - offset);
+        std::memcpy(bytes.get() + offset, src, first);
+        std::memcpy(bytes.get(), static_cast<const char*>(src) + first, length - first);
+    }
+    
+    void copyOut(size_t pos, void* dst, size_t length) const {
+        size_t offset = pos % capacity;
+        size_t first = std::min(length, capacity - offset);
+        std::memcpy(dst, bytes.get() + offset, first);
+        std::memcpy(static_cast<char*>(dst) + first, bytes.get(), length - first);
+    }
+
+public:
+    std::atomic<bool> retired{ false };           // owning thread exited
+    
+    bool push(std::string_view record) {
+        uint32_t length = static_cast<uint32_t>(record.size());
+        size_t pos = tail.load(std::memory_order_relaxed);
+        size_t needed = sizeof(length) + length;
+        if (needed > capacity - (pos - head.load(std::memory_order_acquire))) {
+            return false;
+        }
+        copyIn(pos, &length, sizeof(length));
+        copyIn(pos + sizeof(length), record.data(), length);
+        tail.store(pos + needed, std::memory_order_release);
+        return true;
+    }
+    
+    // Appends every complete record to out; returns whether anything was drained
+    bool drainInto(std::string& out) {
+        size_t pos = head.load(std::memory_order_relaxed);
+        size_t end = tail.load(std::memory_order_acquire);
+        if (pos == end) return false;
+        
+        while (pos != end) {
+            uint32_t length = 0;
+            copyOut(pos, &length, sizeof(length));
+            size_t start = out.size();
+            out.resize(start + length);
+            copyOut(pos + sizeof(length), out.data() + start, length);
+            pos += sizeof(length) + length;
+        }
+        head.store(pos, std::memory_order_release);
+        return true;
+    }
+};
+
+// ✍️ Fixed-size streambuf so records are formatted with plain iostream manipulators
+class RecordBuffer : public std::streambuf {
+private:
+    static constexpr size_t max_record = 8 * 1024;
+    std::array<char, max_record> storage{};
+
+protected:
+    int_type overflow(int_type ch) override {
+        // Record is full: truncate silently rather than grow on the hot path
+        return traits_type::not_eof(ch);
+    }
+
+public:
+    RecordBuffer() { reset(); }
+    
+    void reset() { setp(storage.data(), storage.data() + storage.size()); }
+    
+    std::string_view view() const {
+        return { pbase(), static_cast<size_t>(pptr() - pbase()) };
+    }
+};
+
+class Logger {
+private:
+    struct ThreadState {
+        std::shared_ptr<RecordRing> ring{ std::make_shared<RecordRing>() };
+        RecordBuffer buffer{};
+        std::ostream stream{ &buffer };
+        std::ios_base::fmtflags default_flags{ stream.flags() };
+        
+        explicit ThreadState(Logger& owner) {
+            std::lock_guard<std::mutex> lock(owner.rings_mutex);
+            owner.rings.push_back(ring);
+        }
+        
+        ~ThreadState() { ring->retired.store(true, std::memory_order_release); }
+    };
+    
+    std::mutex rings_mutex{};
+    std::vector<std::shared_ptr<RecordRing>> rings{};
+    
+    std::atomic<bool> running{ true };
+    std::mutex wake_mutex{};
+    std::condition_variable wake{};
+    std::thread flusher{};
+    std::chrono::milliseconds flush_interval{ 20 };
+    
+    std::atomic<uint64_t> records_per_second_limit{ 0 };     // 0 = unlimited
+    std::atomic<int64_t> rate_window_second{ 0 };
+    std::atomic<uint64_t> rate_window_count{ 0 };
+    std::atomic<uint64_t> suppressed{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+    
+    std::mutex flush_mutex{};                                // one drain at a time
+    std::string pending{};
+    uint64_t reported_suppressed{ 0 };
+    
+    ThreadState& threadState() {
+        thread_local ThreadState state{ *this };
+        return state;
+    }
+    
+    void flushLoop() {
+        while (running.load(std::memory_order_acquire)) {
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex);
+                wake.wait_for(lock, flush_interval);
+            }
+            flush();
+        }
+        flush();
+    }
+
+public:
+    // Started in the body so every member above is constructed first
+    Logger() { flusher = std::thread(&Logger::flushLoop, this); }
+    
+    ~Logger() {
+        running.store(false, std::memory_order_release);
+        wake.notify_one();
+        if (flusher.joinable()) flusher.join();
+    }
+    
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+    
+    void setRateLimit(uint64_t records_per_second) {
+        records_per_second_limit.store(records_per_second, std::memory_order_relaxed);
+    }
+    
+    uint64_t suppressedRecords() const { return suppressed.load(std::memory_order_relaxed); }
+    uint64_t droppedRecords() const { return dropped.load(std::memory_order_relaxed); }
+    
+    // Fixed one-second window; false means the caller should skip formatting entirely
+    bool admit() {
+        uint64_t limit = records_per_second_limit.load(std::memory_order_relaxed);
+        if (limit == 0) return true;
+        
+        int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t window = rate_window_second.load(std::memory_order_relaxed);
+        if (second != window && rate_window_second.compare_exchange_strong(window, second, std::memory_order_relaxed)) {
+            rate_window_count.store(0, std::memory_order_relaxed);
+        }
+        
+        if (rate_window_count.fetch_add(1, std::memory_order_relaxed) < limit) return true;
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    std::ostream& begin() {
+        ThreadState& state = threadState();
+        state.buffer.reset();
+        state.stream.clear();
+        state.stream.flags(state.default_flags);
+        state.stream.precision(6);
+        state.stream.fill(' ');
+        return state.stream;
+    }
+    
+    void commit() {
+        ThreadState& state = threadState();
+        if (!state.ring->push(state.buffer.view())) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+    // Drains every thread's ring to stdout; also call before printing directly to std::cout
+    void flush() {
+        std::lock_guard<std::mutex> flush_lock(flush_mutex);
+        pending.clear();
+        
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex);
+            for (auto& ring : rings) {
+                ring->drainInto(pending);
+            }
+            // Rings of exited threads are released once empty
+            rings.erase(std::remove_if(rings.begin(), rings.end(), [this](const std::shared_ptr<RecordRing>& ring) {
+                return ring->retired.load(std::memory_order_acquire) && !ring->drainInto(pending);
+            }), rings.end());
+        }
+        
+        uint64_t now_suppressed = suppressed.load(std::memory_order_relaxed);
+        if (now_suppressed != reported_suppressed) {
+            pending += "⚠️  Log rate limit: " + std::to_string(now_suppressed - reported_suppressed)
+                     + " line(s) suppressed\n";
+            reported_suppressed = now_suppressed;
+        }
+        
+        if (!pending.empty()) {
+            std::fwrite(pending.data(), 1, pending.size(), stdout);
+            std::fflush(stdout);
+        }
+    }
+};
+
+inline Logger& logger() {
+    static Logger instance;
+    return instance;
+}
+
+// 🧾 One log record: format with << like std::cout, committed on destruction
+class Record {
+private:
+    std::ostream* stream{ nullptr };    // null when rate-limited
+
+public:
+    Record() {
+        if (logger().admit()) {
+            stream = &logger().begin();
+        }
+    }
+    
+    ~Record() {
+        if (stream) logger().commit();
+    }
+    
+    Record(const Record&) = delete;
+    Record& operator=(const Record&) = delete;
+    
+    template <typename T>
+    Record& operator<<(const T& value) {
+        if (stream) *stream << value;
+        return *this;
+    }
+    
+    Record& operator<<(std::ostream& (*manipulator)(std::ostream&)) {
+        if (stream) manipulator(*stream);
+        return *this;
+    }
+    
+    Record& operator<<(std::ios_base& (*manipulator)(std::ios_base&)) {
+        if (stream) manipulator(*stream);
+        return *this;
+    }
+    
+    // "[HH:MM:SS] " prefix from the per-second cache
+    Record& timestamp() {
+        if (stream) *stream << '[' << clockText() << "] ";
+        return *this;
+    }
+};
+
+} // namespace AsyncLog
+
+#endif // ASYNC_LOGGER_HPP
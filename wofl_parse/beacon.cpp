@@ -7,7 +7,7 @@ int main() {
         std::string json = runCommand("curl http://127.0.0.1:5000/ping");
 
         std::vector<std::string> lines;
-        ArrayParser parser(json);
+        ArrayParser<std::string> parser(json);
 
         if (parser.parse(lines)) {
             std::cout << "Received response:\n";
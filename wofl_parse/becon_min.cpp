@@ -1,5 +1,5 @@
-#include "Parser.hpp"
-#include "Reflector.hpp"
+#include "parser.hpp"
+#include "reflector.hpp"
 #include <iostream>
 #include <string>
 #include <thread>
@@ -53,7 +53,8 @@ int main() {
         minified.resize(new_len);
 
         PingResponse response;
-        Parser<PingResponse> parser(minified);
+        Tokenizer tokenizer(minified);
+        Parser<PingResponse> parser(tokenizer);
 
         if (parser.parse(response)) {
             std::cout << "=== Parsed Beacon Response ===\n";
@@ -0,0 +1,142 @@
+#ifndef CPU_DISPATCH_HPP
+#define CPU_DISPATCH_HPP
+
+// 🧬 Runtime instruction-set selection for the hand-written SIMD kernels
+// The binary is built for a conservative baseline; kernels that want more
+// (AVX2 today) are compiled with a target attribute and only called when
+// CPUID says the running host has it. LIGHTHOUSE_ISA=scalar|sse2|avx2|avx512
+// can lower the choice (e.g. to compare kernels or dodge a bad host); asking
+// for more than the CPU supports is clamped to what it does support.
+
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define CPU_DISPATCH_X86 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#endif
+
+// MSVC emits any intrinsic without flags; GCC/Clang need the per-function target
+#if defined(CPU_DISPATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define CPU_DISPATCH_TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt,pclmul")))
+#else
+    #define CPU_DISPATCH_TARGET_AVX2
+#endif
+
+namespace CpuDispatch {
+
+// Ordered: a host that runs one level runs everything below it
+enum class Isa : uint8_t {
+    Scalar = 0,
+    Sse2 = 1,
+    Avx2 = 2,       // with BMI2 and PCLMULQDQ
+    Avx512 = 3      // F + BW + VL
+};
+
+inline const char* isaName(Isa isa) {
+    switch (isa) {
+        case Isa::Avx512: return "AVX-512";
+        case Isa::Avx2: return "AVX2";
+        case Isa::Sse2: return "SSE2";
+        default: return "Scalar";
+    }
+}
+
+inline bool parseIsa(std::string_view text, Isa& out) {
+    std::string lower;
+    for (char c : text) lower += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (lower == "scalar") out = Isa::Scalar;
+    else if (lower == "sse2") out = Isa::Sse2;
+    else if (lower == "avx2") out = Isa::Avx2;
+    else if (lower == "avx512" || lower == "avx-512") out = Isa::Avx512;
+    else return false;
+    return true;
+}
+
+// 🔍 CPUID, including the OS check that YMM/ZMM state is actually saved
+inline Isa detectIsa() {
+    #ifdef CPU_DISPATCH_X86
+        #ifdef _MSC_VER
+            int regs[4];
+            __cpuid(regs, 0);
+            int max_leaf = regs[0];
+            __cpuid(regs, 1);
+            bool pclmul = (regs[2] & (1 << 1)) != 0;
+            bool osxsave = (regs[2] & (1 << 27)) != 0;
+            if (max_leaf < 7 || !osxsave) return Isa::Sse2;
+
+            unsigned long long xcr0 = _xgetbv(0);
+            __cpuidex(regs, 7, 0);
+            unsigned ebx = static_cast<unsigned>(regs[1]);
+            bool avx2 = (ebx & (1u << 5)) && (ebx & (1u << 8)) && pclmul && (xcr0 & 0x6) == 0x6;
+            bool avx512 = (ebx & (1u << 16)) && (ebx & (1u << 30)) && (ebx & (1u << 31)) && (xcr0 & 0xE6) == 0xE6;
+            if (avx2 && avx512) return Isa::Avx512;
+            if (avx2) return Isa::Avx2;
+            return Isa::Sse2;
+        #else
+            __builtin_cpu_init();
+            bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")
+                     && __builtin_cpu_supports("pclmul");
+            bool avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+                       && __builtin_cpu_supports("avx512vl");
+            if (avx2 && avx512) return Isa::Avx512;
+            if (avx2) return Isa::Avx2;
+            return Isa::Sse2;
+        #endif
+    #else
+        return Isa::Scalar;
+    #endif
+}
+
+struct IsaSelection {
+    Isa detected{ Isa::Scalar };
+    Isa active{ Isa::Scalar };
+    bool overridden{ false };       // LIGHTHOUSE_ISA was set and understood
+};
+
+inline IsaSelection selectIsa() {
+    IsaSelection selection{};
+    selection.detected = detectIsa();
+    selection.active = selection.detected;
+
+    Isa requested;
+    const char* env = std::getenv("LIGHTHOUSE_ISA");
+    if (env && parseIsa(env, requested)) {
+        selection.overridden = true;
+        if (requested < selection.active) selection.active = requested;
+    }
+    return selection;
+}
+
+// Decided once per process
+inline const IsaSelection& selection() {
+    static const IsaSelection chosen = selectIsa();
+    return chosen;
+}
+
+inline Isa activeIsa() { return selection().active; }
+
+inline bool hasAvx2() { return activeIsa() >= Isa::Avx2; }
+
+// e.g. "AVX2" or "SSE2 (LIGHTHOUSE_ISA, host AVX2)"
+inline std::string describeSelection() {
+    const IsaSelection& s = selection();
+    std::string text = isaName(s.active);
+    if (s.overridden) {
+        text += " (LIGHTHOUSE_ISA, host ";
+        text += isaName(s.detected);
+        text += ")";
+    }
+    return text;
+}
+
+} // namespace CpuDispatch
+
+#endif // CPU_DISPATCH_HPP
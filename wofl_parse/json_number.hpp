@@ -0,0 +1,53 @@
+#ifndef JSON_NUMBER_HPP
+#define JSON_NUMBER_HPP
+
+// 🔢 JSON number grammar (RFC 8259):  -? (0 | [1-9][0-9]*) (.[0-9]+)? ([eE][+-]?[0-9]+)?
+// std::from_chars is more lenient - it takes "01", "1." and "1e" - so every
+// parser checks the text against this first and only then converts it.
+
+#include <cstddef>
+#include <string_view>
+
+namespace JsonNumber {
+
+// Length of the number at the start of text, or 0 when text does not start
+// with one. integral is set when it has neither a fraction nor an exponent.
+inline size_t scan(std::string_view text, bool& integral) {
+    auto digit = [&](size_t at) { return at < text.size() && text[at] >= '0' && text[at] <= '9'; };
+
+    size_t pos = 0;
+    if (pos < text.size() && text[pos] == '-') ++pos;
+    if (!digit(pos)) return 0;
+    if (text[pos] == '0') {
+        ++pos;
+    } else {
+        while (digit(pos)) ++pos;
+    }
+    integral = true;
+
+    if (pos < text.size() && text[pos] == '.') {
+        ++pos;
+        if (!digit(pos)) return 0;
+        while (digit(pos)) ++pos;
+        integral = false;
+    }
+    if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E')) {
+        ++pos;
+        if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) ++pos;
+        if (!digit(pos)) return 0;
+        while (digit(pos)) ++pos;
+        integral = false;
+    }
+    return pos;
+}
+
+// True if the whole of text is one JSON number
+inline bool isNumber(std::string_view text) {
+    bool integral = false;
+    size_t length = scan(text, integral);
+    return length != 0 && length == text.size();
+}
+
+} // namespace JsonNumber
+
+#endif // JSON_NUMBER_HPP
@@ -0,0 +1,94 @@
+#ifndef JSON_SIMPLE_HPP
+#define JSON_SIMPLE_HPP
+
+#include <string>
+#include <map>
+
+#include "utf8_validate.hpp"
+
+// Simple JSON parser - extracts key-value pairs
+inline std::map<std::string, std::string> parse_json_simple(const std::string& json) {
+    std::map<std::string, std::string> result;
+    
+    if (json.empty() || json[0] != '{') {
+        return result;  // Not JSON
+    }
+    
+    // Malformed bytes never reach a key or value string
+    if (!Utf8::validate(json)) {
+        return result;
+    }
+    
+    size_t pos = 1;  // Skip opening '{'
+    
+    while (pos < json.length()) {
+        // Skip whitespace
+        while (pos < json.length() && (json[pos] == ' ' || json[pos] == '\t' || json[pos] == '\n')) {
+            pos++;
+        }
+        
+        if (pos >= json.length() || json[pos] == '}') break;
+        
+        // Find key (should be in quotes)
+        if (json[pos] == '"') {
+            pos++;  // Skip opening quote
+            size_t key_start = pos;
+            
+            // Find closing quote for key
+            while (pos < json.length() && json[pos] != '"') {
+                pos++;
+            }
+            
+            if (pos >= json.length()) break;
+            
+            std::string key = json.substr(key_start, pos - key_start);
+            pos++;  // Skip closing quote
+            
+            // Skip whitespace and colon
+            while (pos < json.length() && (json[pos] == ' ' || json[pos] == ':' || json[pos] == '\t')) {
+                pos++;
+            }
+            
+            // Get value
+            std::string value;
+            if (pos < json.length()) {
+                if (json[pos] == '"') {
+                    // String value
+                    pos++;  // Skip opening quote
+                    size_t value_start = pos;
+                    
+                    while (pos < json.length() && json[pos] != '"') {
+                        pos++;
+                    }
+                    
+                    if (pos < json.length()) {
+                        value = json.substr(value_start, pos - value_start);
+                        pos++;  // Skip closing quote
+                    }
+                } else {
+                    // Number or other value
+                    size_t value_start = pos;
+                    
+                    while (pos < json.length() && json[pos] != ',' && json[pos] != '}' && json[pos] != ' ') {
+                        pos++;
+                    }
+                    
+                    value = json.substr(value_start, pos - value_start);
+                }
+                
+                result[key] = value;
+            }
+            
+            // Skip comma
+            while (pos < json.length() && (json[pos] == ',' || json[pos] == ' ' || json[pos] == '\t')) {
+                pos++;
+            }
+        } else {
+            pos++;  // Skip invalid character
+        }
+    }
+    
+    return result;
+}
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef JSON_STRING_HPP
+#define JSON_STRING_HPP
+
+// 🔡 JSON string contents: finding escapes and decoding them
+// findSpecial() looks for the first backslash or control character 32 bytes
+// at a time (AVX2; scalar elsewhere). Most strings on the wire have neither,
+// so a parser can hand back a view of the input as-is and only run
+// unescapeInto() - one compact copy - for the strings that need it.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "cpu_dispatch.hpp"
+
+namespace JsonString {
+
+namespace detail {
+
+inline uint32_t hexValue(char c) {
+    if (c >= '0' && c <= '9') return static_cast<uint32_t>(c - '0');
+    if (c >= 'a' && c <= 'f') return static_cast<uint32_t>(c - 'a' + 10);
+    if (c >= 'A' && c <= 'F') return static_cast<uint32_t>(c - 'A' + 10);
+    return 0xFFFFFFFF;
+}
+
+inline bool readHex4(std::string_view text, size_t at, uint32_t& out) {
+    if (at + 4 > text.size()) return false;
+    out = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        uint32_t digit = hexValue(text[at + i]);
+        if (digit > 15) return false;
+        out = (out << 4) | digit;
+    }
+    return true;
+}
+
+inline void appendUtf8(std::vector<char>& out, uint32_t code_point) {
+    if (code_point < 0x80) {
+        out.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+inline size_t findSpecialScalar(std::string_view raw, size_t from) {
+    for (size_t i = from; i < raw.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(raw[i]);
+        if (c == '\\' || c < 0x20) return i;
+    }
+    return raw.size();
+}
+
+#ifdef CPU_DISPATCH_X86
+CPU_DISPATCH_TARGET_AVX2 inline size_t findSpecialAvx2(std::string_view raw) {
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i control_max = _mm256_set1_epi8(0x1F);
+    size_t i = 0;
+    for (; i + 32 <= raw.size(); i += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(raw.data() + i));
+        // Unsigned byte <= 0x1F exactly when min(byte, 0x1F) == byte
+        __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(block, control_max), block);
+        __m256i special = _mm256_or_si256(control, _mm256_cmpeq_epi8(block, backslash));
+        uint32_t hits = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+        if (hits) return i + static_cast<size_t>(std::countr_zero(hits));
+    }
+    return findSpecialScalar(raw, i);
+}
+#endif
+
+} // namespace detail
+
+// Offset of the first backslash or control character (< 0x20) in the raw
+// contents of a string, or raw.size() when there is neither - i.e. when the
+// raw bytes already are the decoded string.
+inline size_t findSpecial(std::string_view raw) {
+    #ifdef CPU_DISPATCH_X86
+        if (raw.size() >= 32 && CpuDispatch::hasAvx2()) return detail::findSpecialAvx2(raw);
+    #endif
+    return detail::findSpecialScalar(raw, 0);
+}
+
+// Appends the unescaped text to out. Returns the offset (within raw) of the
+// first bad escape or control character, or raw.size() when all is well.
+inline size_t unescapeInto(std::string_view raw, std::vector<char>& out) {
+    size_t i = 0;
+    while (i < raw.size()) {
+        // Copy the run up to the next backslash in one go
+        size_t run_end = i + findSpecial(raw.substr(i));
+        out.insert(out.end(), raw.data() + i, raw.data() + run_end);
+        i = run_end;
+        if (i == raw.size()) break;
+        if (raw[i] != '\\') return i;
+
+        if (i + 1 >= raw.size()) return i;
+        char escape = raw[i + 1];
+        switch (escape) {
+            case '"': out.push_back('"'); break;
+            case '\\': out.push_back('\\'); break;
+            case '/': out.push_back('/'); break;
+            case 'b': out.push_back('\b'); break;
+            case 'f': out.push_back('\f'); break;
+            case 'n': out.push_back('\n'); break;
+            case 'r': out.push_back('\r'); break;
+            case 't': out.push_back('\t'); break;
+            case 'u': {
+                uint32_t code_point = 0;
+                if (!detail::readHex4(raw, i + 2, code_point)) return i;
+                size_t consumed = 6;
+
+                // A high surrogate must be followed by an escaped low one
+                if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+                    uint32_t low = 0;
+                    if (i + 7 >= raw.size() || raw[i + 6] != '\\' || raw[i + 7] != 'u'
+                        || !detail::readHex4(raw, i + 8, low) || low < 0xDC00 || low > 0xDFFF) {
+                        return i;
+                    }
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    consumed = 12;
+                } else if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+                    return i;
+                }
+
+                detail::appendUtf8(out, code_point);
+                i += consumed;
+                continue;
+            }
+            default:
+                return i;
+        }
+        i += 2;
+    }
+    return raw.size();
+}
+
+} // namespace JsonString
+
+#endif // JSON_STRING_HPP
@@ -1,15 +1,96 @@
 #include "avx2_minifier_core.hpp"
-#include <immintrin.h>
+#include "../cpu_dispatch.hpp"
+#include <bit>
+#include <cstdint>
 #include <string>
 
+// Whitespace stripping with a per-ISA body chosen at runtime (CpuDispatch).
+// Each SIMD step classifies a chunk; whitespace-free chunks are copied whole,
+// the rest are compacted by walking the keep-mask bits.
+
+namespace {
+
+inline bool isJsonSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+size_t minifyScalar(const char* src, size_t length, char* dst, size_t i, size_t out) {
+    for (; i < length; ++i) {
+        if (!isJsonSpace(src[i])) dst[out++] = src[i];
+    }
+    return out;
+}
+
+inline size_t compact(const char* chunk, uint32_t keep, size_t width, char* dst, size_t out) {
+    if (keep == (width == 32 ? 0xFFFFFFFFu : 0xFFFFu)) {
+        for (size_t j = 0; j < width; ++j) dst[out + j] = chunk[j];
+        return out + width;
+    }
+    while (keep) {
+        dst[out++] = chunk[std::countr_zero(keep)];
+        keep &= keep - 1;
+    }
+    return out;
+}
+
+#ifdef CPU_DISPATCH_X86
+
+size_t minifySse2(const char* src, size_t length, char* dst) {
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i carriage = _mm_set1_epi8('\r');
+
+    size_t i = 0;
+    size_t out = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, newline)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, carriage)));
+        uint32_t keep = ~static_cast<uint32_t>(_mm_movemask_epi8(ws)) & 0xFFFFu;
+        out = compact(src + i, keep, 16, dst, out);
+    }
+    return minifyScalar(src, length, dst, i, out);
+}
+
+CPU_DISPATCH_TARGET_AVX2 size_t minifyAvx2(const char* src, size_t length, char* dst) {
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i carriage = _mm256_set1_epi8('\r');
+
+    size_t i = 0;
+    size_t out = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, newline)),
+                                     _mm256_or_si256(_mm256_cmpeq_epi8(chunk, tab), _mm256_cmpeq_epi8(chunk, carriage)));
+        uint32_t keep = ~static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+        out = compact(src + i, keep, 32, dst, out);
+    }
+    return minifyScalar(src, length, dst, i, out);
+}
+
+#endif // CPU_DISPATCH_X86
+
+} // namespace
+
 std::string minify_json_avx2(const std::string& input) {
-    std::string output;
-    output.reserve(input.size());
+    std::string output(input.size(), '\0');
+    size_t length = 0;
 
-    for (char c : input) {
-        if (c != ' ' && c != '\n' && c != '\t' && c != '\r') {
-            output += c;
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) {
+            length = minifyAvx2(input.data(), input.size(), output.data());
+        } else if (CpuDispatch::activeIsa() >= CpuDispatch::Isa::Sse2) {
+            length = minifySse2(input.data(), input.size(), output.data());
+        } else {
+            length = minifyScalar(input.data(), input.size(), output.data(), 0, 0);
         }
-    }
+    #else
+        length = minifyScalar(input.data(), input.size(), output.data(), 0, 0);
+    #endif
+
+    output.resize(length);
     return output;
 }
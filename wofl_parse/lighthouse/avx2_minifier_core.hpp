@@ -3,6 +3,7 @@
 
 #include <string>
 
+// Strips JSON whitespace; AVX2, SSE2 or scalar per CpuDispatch::activeIsa()
 std::string minify_json_avx2(const std::string& input);
 
 #endif
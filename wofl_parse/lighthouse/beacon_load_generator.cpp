@@ -0,0 +1,357 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <signal.h>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #pragma comment(lib, "ws2_32.lib")
+    #define close closesocket
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+    #include <unistd.h>
+#endif
+
+#include "datagram_engine.hpp"
+
+// 💥 BEACON LOAD GENERATOR
+// Simulates a fleet of lighthouses against one listener to find the highest
+// beacon rate it sustains without loss.
+//
+// - N virtual lighthouses, each with its own beacon_id and sequence counter
+// - Payloads are serialized once; only the timestamp and sequence digits are
+//   patched per send
+// - Batches go out through a DatagramEngine sender (sendmmsg by default,
+//   io_uring when built with liburing, sendto loop on Windows)
+// - The rate ramps in steps; compare the per-step sent counts with the
+//   listener's "Total Beacons" and "Missed Beacons" to find the knee
+
+namespace LoadGenerator {
+
+struct LoadOptions {
+    std::string target_ip{ "127.0.0.1" };
+    int port{ 9876 };
+    uint32_t lighthouses{ 64 };
+    uint64_t start_rate{ 10000 };      // beacons/second
+    uint64_t max_rate{ 500000 };
+    uint64_t rate_step{ 10000 };
+    uint32_t step_seconds{ 5 };
+    uint32_t batch_size{ 64 };         // datagrams per flush
+    DatagramEngine::EngineKind engine{ DatagramEngine::EngineKind::Recvmmsg };
+};
+
+// 🏰 One virtual lighthouse: a pre-serialized beacon with fixed-width timestamp and sequence slots
+struct VirtualLighthouse {
+    std::string payload;
+    size_t timestamp_offset{ 0 };
+    size_t sequence_offset{ 0 };
+    uint32_t next_sequence{ 1 };
+    uint64_t sent{ 0 };
+};
+
+class BeaconLoadGenerator {
+private:
+    // Space-padded so every value fits without re-serializing; JSON allows the whitespace
+    static constexpr size_t sequence_width = 10;
+    static constexpr size_t timestamp_width = 10;     // Unix seconds, as the beacon sends them
+    
+    LoadOptions options;
+    std::vector<VirtualLighthouse> lighthouses;
+    std::atomic<bool> running{ true };
+    int sock{ -1 };
+    sockaddr_in target_addr{};
+    
+    // One buffer per batch slot so a lighthouse can appear twice in a batch
+    std::vector<std::string> slot_buffers;
+    std::unique_ptr<DatagramEngine::SendEngine> sender;
+
+public:
+    explicit BeaconLoadGenerator(const LoadOptions& opts) : options(opts) {
+        lighthouses.reserve(options.lighthouses);
+        for (uint32_t i = 0; i < options.lighthouses; ++i) {
+            lighthouses.push_back(buildLighthouse(i));
+        }
+        
+        slot_buffers.resize(options.batch_size);
+    }
+    
+    ~BeaconLoadGenerator() {
+        if (sock >= 0) {
+            close(sock);
+        }
+    }
+    
+    bool initialize() {
+        #ifdef _WIN32
+            WSADATA wsaData;
+            if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+                std::cerr << "🚨 WSAStartup failed\n";
+                return false;
+            }
+        #endif
+        
+        sock = static_cast<int>(socket(AF_INET, SOCK_DGRAM, 0));
+        if (sock < 0) {
+            std::cerr << "🚨 Failed to create UDP socket\n";
+            return false;
+        }
+        
+        // Deep send buffer so the generator is not the bottleneck
+        int sndbuf = 8 * 1024 * 1024;
+        setsockopt(sock, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&sndbuf), sizeof(sndbuf));
+        
+        target_addr.sin_family = AF_INET;
+        target_addr.sin_port = htons(options.port);
+        if (inet_pton(AF_INET, options.target_ip.c_str(), &target_addr.sin_addr) != 1) {
+            std::cerr << "🚨 Invalid target address: " << options.target_ip << "\n";
+            return false;
+        }
+        
+        sender = DatagramEngine::createSendEngine(options.engine, sock);
+        
+        std::cout << "💥 Load generator ready: " << options.lighthouses << " virtual lighthouses -> "
+                 << options.target_ip << ":" << options.port << "\n";
+        std::cout << "   Payload size: " << lighthouses.front().payload.size() << " bytes, batch "
+                 << options.batch_size << " datagrams via "
+                 << DatagramEngine::engineName(sender->kind()) << "\n\n";
+        return true;
+    }
+    
+    void stop() {
+        running.store(false);
+    }
+    
+    // 📈 Ramp from start_rate to max_rate, holding each step for step_seconds
+    void run() {
+        std::cout << std::left << std::setw(14) << "Target/s"
+                 << std::setw(14) << "Achieved/s"
+                 << std::setw(14) << "Sent"
+                 << std::setw(14) << "Send Errors"
+                 << "Cumulative\n";
+        std::cout << std::string(70, '-') << "\n";
+        
+        uint64_t cumulative = 0;
+        size_t next_lighthouse = 0;
+        
+        for (uint64_t rate = options.start_rate; rate <= options.max_rate && running.load(); rate += options.rate_step) {
+            uint64_t step_sent = 0;
+            uint64_t step_errors = 0;
+            
+            auto batch_interval = std::chrono::nanoseconds(
+                static_cast<int64_t>(1e9 * options.batch_size / static_cast<double>(rate)));
+            auto step_start = std::chrono::steady_clock::now();
+            auto step_end = step_start + std::chrono::seconds(options.step_seconds);
+            auto next_send = step_start;
+            
+            while (running.load() && std::chrono::steady_clock::now() < step_end) {
+                uint32_t count = prepareBatch(next_lighthouse);
+                uint32_t sent = sendBatch(count);
+                step_sent += sent;
+                step_errors += count - sent;
+                
+                next_send += batch_interval;
+                auto now = std::chrono::steady_clock::now();
+                if (next_send > now) {
+                    std::this_thread::sleep_until(next_send);
+                } else if (now - next_send > std::chrono::milliseconds(100)) {
+                    // Fell badly behind (e.g. descheduled); don't burst to catch up
+                    next_send = now;
+                }
+            }
+            
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - step_start).count();
+            cumulative += step_sent;
+            
+            std::cout << std::left << std::setw(14) << rate
+                     << std::setw(14) << std::fixed << std::setprecision(0) << (elapsed > 0.0 ? step_sent / elapsed : 0.0)
+                     << std::setw(14) << step_sent
+                     << std::setw(14) << step_errors
+                     << cumulative << "\n";
+        }
+        
+        displaySummary(cumulative);
+    }
+
+private:
+    VirtualLighthouse buildLighthouse(uint32_t index) {
+        std::ostringstream id;
+        id << "loadgen-lighthouse-" << std::setw(5) << std::setfill('0') << index;
+        
+        VirtualLighthouse lighthouse;
+        std::ostringstream json;
+        json << R"({"beacon_id":")" << id.str() << R"(","timestamp":)";
+        lighthouse.timestamp_offset = static_cast<size_t>(json.tellp());
+        json << std::string(timestamp_width, ' ')
+             << R"(,"status":"healthy","last_ping_status":"ok","ping_latency_ms":12.5,"signal_age_seconds":0)"
+             << R"(,"json_parse_time_microseconds":0.8,"json_serialize_time_microseconds":0.5)"
+             << R"(,"total_requests_processed":1000,"successful_parses":1000,"failed_parses":0)"
+             << R"json(,"average_throughput_mbps":950.0,"cpu_optimization_level":"AVX2 + BMI2 (HIGH PERFORMANCE)")json"
+             << R"(,"system_uptime_hours":1.0,"beacon_sequence_number":)";
+        
+        lighthouse.payload = json.str();
+        lighthouse.sequence_offset = lighthouse.payload.size();
+        lighthouse.payload.append(sequence_width, ' ');
+        lighthouse.payload += R"(,"lighthouse_version":"loadgen-1.0"})";
+        return lighthouse;
+    }
+    
+    // ✍️ Right-align a number in its padded slot (no allocation, no reformatting)
+    static void patchNumber(char* slot, size_t width, uint64_t value) {
+        char* end = slot + width;
+        char* out = end;
+        do {
+            *--out = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0 && out > slot);
+        std::memset(slot, ' ', static_cast<size_t>(out - slot));
+    }
+    
+    uint32_t prepareBatch(size_t& next_lighthouse) {
+        // One clock read per batch; the field only has whole seconds
+        uint64_t now_seconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        
+        for (uint32_t i = 0; i < options.batch_size; ++i) {
+            VirtualLighthouse& lighthouse = lighthouses[next_lighthouse];
+            if (++next_lighthouse == lighthouses.size()) next_lighthouse = 0;
+            
+            std::string& buffer = slot_buffers[i];
+            buffer.assign(lighthouse.payload);
+            patchNumber(buffer.data() + lighthouse.timestamp_offset, timestamp_width, now_seconds);
+            patchNumber(buffer.data() + lighthouse.sequence_offset, sequence_width, lighthouse.next_sequence++);
+            lighthouse.sent++;
+            
+            sender->queue(buffer.data(), buffer.size(), target_addr);
+        }
+        return options.batch_size;
+    }
+    
+    uint32_t sendBatch(uint32_t count) {
+        return static_cast<uint32_t>(std::min<size_t>(sender->flush(), count));
+    }
+    
+    void displaySummary(uint64_t total_sent) {
+        uint64_t min_sent = UINT64_MAX;
+        uint64_t max_sent = 0;
+        for (const auto& lighthouse : lighthouses) {
+            min_sent = std::min(min_sent, lighthouse.sent);
+            max_sent = std::max(max_sent, lighthouse.sent);
+        }
+        
+        std::cout << "\n🎯 LOAD GENERATOR SUMMARY:\n";
+        std::cout << "   Total Beacons Sent: " << total_sent << "\n";
+        std::cout << "   Virtual Lighthouses: " << lighthouses.size()
+                 << " (" << min_sent << "-" << max_sent << " beacons each)\n";
+        std::cout << "   Compare with the listener's Total Beacons + Missed Beacons;\n";
+        std::cout << "   the last step where both add up to Sent is the max lossless rate.\n\n";
+    }
+};
+
+} // namespace LoadGenerator
+
+std::unique_ptr<LoadGenerator::BeaconLoadGenerator> g_generator;
+
+void signalHandler([[maybe_unused]] int signal) {
+    if (g_generator) {
+        g_generator->stop();
+    }
+}
+
+void displayHelp(const char* program_name) {
+    std::cout << R"(
+💥 Beacon Load Generator
+Usage: )" << program_name << R"( [OPTIONS]
+
+OPTIONS:
+   -t, --target IP          Listener address (default: 127.0.0.1)
+   -p, --port PORT          Listener port (default: 9876)
+   -n, --lighthouses N      Virtual lighthouses (default: 64)
+   -r, --rate START         Starting beacons/second (default: 10000)
+   -m, --max-rate MAX       Final beacons/second (default: 500000)
+   -S, --step STEP          Rate increase per step (default: 10000)
+   -d, --duration SECONDS   Seconds per step (default: 5)
+   -b, --batch N            Datagrams per send flush (default: 64)
+   -e, --engine NAME        Send engine: sendto, sendmmsg, io_uring (default: sendmmsg)
+   -h, --help               Show this help message
+)";
+}
+
+int main(int argc, char* argv[]) {
+    LoadGenerator::LoadOptions options;
+    
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::runtime_error(arg + " requires a value");
+                }
+                return argv[++i];
+            };
+            
+            if (arg == "-h" || arg == "--help") {
+                displayHelp(argv[0]);
+                return 0;
+            } else if (arg == "-t" || arg == "--target") {
+                options.target_ip = value();
+            } else if (arg == "-p" || arg == "--port") {
+                options.port = std::stoi(value());
+            } else if (arg == "-n" || arg == "--lighthouses") {
+                options.lighthouses = static_cast<uint32_t>(std::stoul(value()));
+            } else if (arg == "-r" || arg == "--rate") {
+                options.start_rate = std::stoull(value());
+            } else if (arg == "-m" || arg == "--max-rate") {
+                options.max_rate = std::stoull(value());
+            } else if (arg == "-S" || arg == "--step") {
+                options.rate_step = std::stoull(value());
+            } else if (arg == "-d" || arg == "--duration") {
+                options.step_seconds = static_cast<uint32_t>(std::stoul(value()));
+            } else if (arg == "-b" || arg == "--batch") {
+                options.batch_size = static_cast<uint32_t>(std::stoul(value()));
+            } else if (arg == "-e" || arg == "--engine") {
+                if (!DatagramEngine::parseEngineKind(value(), options.engine)) {
+                    std::cerr << "❌ Error: --engine requires sendto, sendmmsg or io_uring\n";
+                    return 1;
+                }
+            } else {
+                std::cerr << "❌ Unknown option: " << arg << "\n";
+                return 1;
+            }
+        }
+        
+        if (options.lighthouses == 0 || options.batch_size == 0 || options.start_rate == 0 || options.rate_step == 0) {
+            std::cerr << "❌ Error: lighthouses, batch, rate and step must be positive\n";
+            return 1;
+        }
+        
+        signal(SIGINT, signalHandler);
+        #ifndef _WIN32
+        signal(SIGTERM, signalHandler);
+        #endif
+        
+        g_generator = std::make_unique<LoadGenerator::BeaconLoadGenerator>(options);
+        if (!g_generator->initialize()) {
+            return 1;
+        }
+        g_generator->run();
+    
+    } catch (const std::exception& e) {
+        std::cerr << "🚨 Fatal Error: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
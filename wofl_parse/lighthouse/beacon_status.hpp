@@ -0,0 +1,63 @@
+#ifndef BEACON_STATUS_HPP
+#define BEACON_STATUS_HPP
+
+// 🚦 Compact lighthouse health status
+// One byte per lighthouse instead of a status string, so per-lighthouse
+// tables can hold it in a dense column and count it with SIMD compares.
+// Wire strings are decoded once where the JSON is parsed; everything
+// downstream compares enums and only turns them back into text to print.
+
+#include <cstdint>
+#include <string_view>
+
+namespace BeaconStatus {
+
+enum class Health : uint8_t {
+    Unknown = 0,    // never reported, or a status string we don't recognise
+    Healthy = 1,
+    Warning = 2,
+    Critical = 3
+};
+
+// FastPing "status" field as carried in last_ping_status
+enum class PingStatus : uint8_t {
+    Unknown = 0,    // no response yet
+    Ok = 1,
+    Failed = 2      // anything other than "ok"
+};
+
+inline Health decodeHealth(std::string_view text) {
+    if (text == "healthy") return Health::Healthy;
+    if (text == "warning") return Health::Warning;
+    if (text == "critical") return Health::Critical;
+    return Health::Unknown;
+}
+
+inline PingStatus decodePing(std::string_view text) {
+    if (text.empty()) return PingStatus::Unknown;
+    return text == "ok" ? PingStatus::Ok : PingStatus::Failed;
+}
+
+// Wire form, also used for display
+inline const char* healthName(Health health) {
+    switch (health) {
+        case Health::Healthy: return "healthy";
+        case Health::Warning: return "warning";
+        case Health::Critical: return "critical";
+        default: return "unknown";
+    }
+}
+
+// Upper-case form for status banners
+inline const char* healthLabel(Health health) {
+    switch (health) {
+        case Health::Healthy: return "HEALTHY";
+        case Health::Warning: return "WARNING";
+        case Health::Critical: return "CRITICAL";
+        default: return "UNKNOWN";
+    }
+}
+
+} // namespace BeaconStatus
+
+#endif // BEACON_STATUS_HPP
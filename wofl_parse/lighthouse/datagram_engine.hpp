@@ -0,0 +1,537 @@
+#ifndef DATAGRAM_ENGINE_HPP
+#define DATAGRAM_ENGINE_HPP
+
+// 🚀 Pluggable UDP receive/send engines
+//
+// Receive: recvfrom (one recvmsg per datagram), recvmmsg (one syscall per
+// batch) and, when built with LIGHTHOUSE_HAVE_LIBURING, io_uring multishot
+// recvmsg into a provided-buffer ring (no syscall per datagram at all while
+// the ring is armed).
+//
+// Send: sendto, sendmmsg and io_uring batched SENDMSG SQEs.
+//
+// Every engine hands out views into its own buffers. A receive batch stays
+// valid until the next receive() call on the same engine; queued sends must
+// stay alive until flush().
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../listener_socket.hpp"
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <sys/time.h>
+#endif
+
+#ifdef LIGHTHOUSE_HAVE_LIBURING
+    #include <liburing.h>
+#endif
+
+namespace DatagramEngine {
+
+enum class EngineKind : uint8_t { Recvfrom, Recvmmsg, IoUring };
+
+inline const char* engineName(EngineKind kind) {
+    switch (kind) {
+        case EngineKind::Recvfrom: return "recvfrom";
+        case EngineKind::Recvmmsg: return "recvmmsg";
+        case EngineKind::IoUring: return "io_uring";
+    }
+    return "unknown";
+}
+
+inline bool parseEngineKind(std::string_view name, EngineKind& kind) {
+    if (name == "recvfrom" || name == "sendto") { kind = EngineKind::Recvfrom; return true; }
+    if (name == "recvmmsg" || name == "sendmmsg") { kind = EngineKind::Recvmmsg; return true; }
+    if (name == "io_uring" || name == "uring") { kind = EngineKind::IoUring; return true; }
+    return false;
+}
+
+struct Datagram {
+    const char* data{ nullptr };
+    size_t length{ 0 };
+    bool truncated{ false };    // longer than max_datagram_size: data holds only the first length bytes
+    sockaddr_in source{};
+    ListenerSocket::ReceiveMetadata meta{};
+    
+    std::string_view view() const { return { data, length }; }
+};
+
+struct EngineOptions {
+    size_t batch_size{ 32 };
+    size_t max_datagram_size{ 8192 };
+    // receive() returns 0 after this long without traffic so callers can notice shutdown
+    std::chrono::milliseconds wake_interval{ 250 };
+};
+
+// 📥 Receive side
+class ReceiveEngine {
+public:
+    virtual ~ReceiveEngine() = default;
+    virtual EngineKind kind() const = 0;
+    
+    // Blocks for at least one datagram (or wake_interval); returns how many are in batch()
+    virtual size_t receive() = 0;
+    virtual const std::vector<Datagram>& batch() const = 0;
+};
+
+// 📤 Send side
+class SendEngine {
+public:
+    virtual ~SendEngine() = default;
+    virtual EngineKind kind() const = 0;
+    
+    // data must remain valid until flush()
+    virtual void queue(const char* data, size_t length, const sockaddr_in& target) = 0;
+    // Sends everything queued; returns the number of datagrams accepted by the kernel
+    virtual size_t flush() = 0;
+};
+
+inline void applyWakeInterval(int fd, std::chrono::milliseconds wake_interval) {
+    #ifdef _WIN32
+        DWORD timeout = static_cast<DWORD>(wake_interval.count());
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+    #else
+        timeval timeout{};
+        timeout.tv_sec = static_cast<time_t>(wake_interval.count() / 1000);
+        timeout.tv_usec = static_cast<suseconds_t>((wake_interval.count() % 1000) * 1000);
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    #endif
+}
+
+// 🐢 One datagram per syscall (portable baseline)
+class RecvfromEngine : public ReceiveEngine {
+private:
+    int fd;
+    std::vector<char> buffer;
+    std::vector<Datagram> datagrams;
+
+public:
+    RecvfromEngine(int socket_fd, const EngineOptions& options)
+        : fd(socket_fd), buffer(options.max_datagram_size) {
+        applyWakeInterval(fd, options.wake_interval);
+        datagrams.reserve(1);
+    }
+    
+    EngineKind kind() const override { return EngineKind::Recvfrom; }
+    
+    size_t receive() override {
+        datagrams.clear();
+        
+        Datagram datagram{};
+        long received = ListenerSocket::receiveWithMetadata(fd, buffer.data(), buffer.size(),
+                                                            &datagram.source, datagram.meta, &datagram.truncated);
+        if (received <= 0) return 0;
+        
+        datagram.data = buffer.data();
+        datagram.length = static_cast<size_t>(received);
+        datagrams.push_back(datagram);
+        return 1;
+    }
+    
+    const std::vector<Datagram>& batch() const override { return datagrams; }
+};
+
+class SendtoEngine : public SendEngine {
+private:
+    struct Pending {
+        const char* data;
+        size_t length;
+        sockaddr_in target;
+    };
+    
+    int fd;
+    std::vector<Pending> pending;
+
+public:
+    explicit SendtoEngine(int socket_fd) : fd(socket_fd) {}
+    
+    EngineKind kind() const override { return EngineKind::Recvfrom; }
+    
+    void queue(const char* data, size_t length, const sockaddr_in& target) override {
+        pending.push_back({ data, length, target });
+    }
+    
+    size_t flush() override {
+        size_t sent = 0;
+        for (const auto& p : pending) {
+            if (sendto(fd, p.data, static_cast<int>(p.length), 0,
+                       reinterpret_cast<const sockaddr*>(&p.target), sizeof(p.target)) >= 0) {
+                sent++;
+            }
+        }
+        pending.clear();
+        return sent;
+    }
+};
+
+#ifdef __linux__
+// ⚡ One syscall per batch
+class RecvmmsgEngine : public ReceiveEngine {
+private:
+    int fd;
+    size_t max_datagram_size;
+    std::vector<char> buffers;
+    std::vector<sockaddr_in> sources;
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> headers;
+    std::vector<ListenerSocket::ControlBuffer> controls;
+    std::vector<Datagram> datagrams;
+
+public:
+    RecvmmsgEngine(int socket_fd, const EngineOptions& options)
+        : fd(socket_fd), max_datagram_size(options.max_datagram_size),
+          buffers(options.batch_size * options.max_datagram_size), sources(options.batch_size),
+          iovecs(options.batch_size), headers(options.batch_size), controls(options.batch_size) {
+        applyWakeInterval(fd, options.wake_interval);
+        datagrams.reserve(options.batch_size);
+    }
+    
+    EngineKind kind() const override { return EngineKind::Recvmmsg; }
+    
+    size_t receive() override {
+        datagrams.clear();
+        
+        for (size_t i = 0; i < headers.size(); ++i) {
+            iovecs[i].iov_base = buffers.data() + i * max_datagram_size;
+            iovecs[i].iov_len = max_datagram_size;
+            
+            msghdr& hdr = headers[i].msg_hdr;
+            hdr = msghdr{};
+            hdr.msg_name = &sources[i];
+            hdr.msg_namelen = sizeof(sockaddr_in);
+            hdr.msg_iov = &iovecs[i];
+            hdr.msg_iovlen = 1;
+            hdr.msg_control = controls[i].data;
+            hdr.msg_controllen = sizeof(controls[i].data);
+        }
+        
+        // MSG_WAITFORONE: block for the first datagram, then take whatever else is queued
+        int received = recvmmsg(fd, headers.data(), static_cast<unsigned int>(headers.size()), MSG_WAITFORONE, nullptr);
+        if (received <= 0) return 0;
+        
+        for (int i = 0; i < received; ++i) {
+            Datagram datagram{};
+            datagram.data = static_cast<const char*>(iovecs[i].iov_base);
+            datagram.length = headers[i].msg_len;
+            datagram.truncated = (headers[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+            datagram.source = sources[i];
+            datagram.meta = ListenerSocket::parseReceiveMetadata(headers[i].msg_hdr);
+            datagrams.push_back(datagram);
+        }
+        return datagrams.size();
+    }
+    
+    const std::vector<Datagram>& batch() const override { return datagrams; }
+};
+
+class SendmmsgEngine : public SendEngine {
+private:
+    int fd;
+    std::vector<sockaddr_in> targets;
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> headers;
+
+public:
+    explicit SendmmsgEngine(int socket_fd) : fd(socket_fd) {}
+    
+    EngineKind kind() const override { return EngineKind::Recvmmsg; }
+    
+    void queue(const char* data, size_t length, const sockaddr_in& target) override {
+        targets.push_back(target);
+        iovecs.push_back({ const_cast<char*>(data), length });
+    }
+    
+    size_t flush() override {
+        // Headers are wired up here because the vectors above may have reallocated
+        headers.resize(iovecs.size());
+        for (size_t i = 0; i < iovecs.size(); ++i) {
+            std::memset(&headers[i], 0, sizeof(mmsghdr));
+            headers[i].msg_hdr.msg_name = &targets[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+        
+        size_t sent = 0;
+        while (sent < headers.size()) {
+            int result = sendmmsg(fd, headers.data() + sent, static_cast<unsigned int>(headers.size() - sent), 0);
+            if (result <= 0) break;
+            sent += static_cast<size_t>(result);
+        }
+        
+        targets.clear();
+        iovecs.clear();
+        return sent;
+    }
+};
+#endif
+
+#ifdef LIGHTHOUSE_HAVE_LIBURING
+// A submission queue entry; when the queue is full, submits what is queued and tries once more
+inline io_uring_sqe* acquireSqe(io_uring& ring) {
+    io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+    if (sqe) return sqe;
+    io_uring_submit(&ring);
+    return io_uring_get_sqe(&ring);
+}
+
+// 💍 io_uring multishot recvmsg into a provided-buffer ring (liburing >= 2.4, kernel >= 6.0)
+// Each buffer receives io_uring_recvmsg_out + source address + control data + payload.
+// Buffers of the previous batch are handed back to the kernel at the next receive().
+class IoUringReceiveEngine : public ReceiveEngine {
+private:
+    static constexpr int buffer_group = 7;
+    static constexpr unsigned ring_entries = 64;
+    
+    int fd;
+    io_uring ring{};
+    io_uring_buf_ring* buf_ring{ nullptr };
+    unsigned buffer_count;
+    size_t buffer_size;
+    std::vector<char> buffer_memory;
+    msghdr msg_template{};
+    bool armed{ false };
+    bool initialized{ false };
+    std::chrono::milliseconds wake_interval;
+    std::vector<uint16_t> in_use;
+    std::vector<io_uring_cqe*> cqes;
+    std::vector<Datagram> datagrams;
+
+public:
+    IoUringReceiveEngine(int socket_fd, const EngineOptions& options)
+        : fd(socket_fd), wake_interval(options.wake_interval) {
+        // Enough buffers for several full batches in flight; must be a power of two
+        buffer_count = 1;
+        while (buffer_count < options.batch_size * 8) buffer_count <<= 1;
+        buffer_size = sizeof(io_uring_recvmsg_out) + sizeof(sockaddr_in)
+                    + sizeof(ListenerSocket::ControlBuffer) + options.max_datagram_size;
+        buffer_memory.resize(static_cast<size_t>(buffer_count) * buffer_size);
+        cqes.resize(options.batch_size);
+        datagrams.reserve(options.batch_size);
+        in_use.reserve(options.batch_size);
+        
+        msg_template.msg_namelen = sizeof(sockaddr_in);
+        msg_template.msg_controllen = sizeof(ListenerSocket::ControlBuffer);
+        
+        if (io_uring_queue_init(ring_entries, &ring, 0) < 0) return;
+        
+        int ret = 0;
+        buf_ring = io_uring_setup_buf_ring(&ring, buffer_count, buffer_group, 0, &ret);
+        if (!buf_ring) {
+            io_uring_queue_exit(&ring);
+            return;
+        }
+        
+        for (unsigned i = 0; i < buffer_count; ++i) {
+            io_uring_buf_ring_add(buf_ring, bufferAt(i), static_cast<unsigned>(buffer_size),
+                                  static_cast<unsigned short>(i), io_uring_buf_ring_mask(buffer_count), static_cast<int>(i));
+        }
+        io_uring_buf_ring_advance(buf_ring, static_cast<int>(buffer_count));
+        initialized = true;
+    }
+    
+    ~IoUringReceiveEngine() override {
+        if (!initialized) return;
+        io_uring_free_buf_ring(&ring, buf_ring, buffer_count, buffer_group);
+        io_uring_queue_exit(&ring);
+    }
+    
+    bool ok() const { return initialized; }
+    
+    EngineKind kind() const override { return EngineKind::IoUring; }
+    
+    size_t receive() override {
+        recycle();
+        datagrams.clear();
+        
+        if (!armed) arm();
+        
+        io_uring_cqe* first = nullptr;
+        __kernel_timespec timeout{};
+        timeout.tv_sec = wake_interval.count() / 1000;
+        timeout.tv_nsec = (wake_interval.count() % 1000) * 1000000;
+        if (io_uring_submit_and_wait_timeout(&ring, &first, 1, &timeout, nullptr) < 0 || first == nullptr) {
+            return 0;
+        }
+        
+        unsigned ready = io_uring_peek_batch_cqe(&ring, cqes.data(), static_cast<unsigned>(cqes.size()));
+        for (unsigned i = 0; i < ready; ++i) {
+            consume(cqes[i]);
+        }
+        io_uring_cq_advance(&ring, ready);
+        return datagrams.size();
+    }
+    
+    const std::vector<Datagram>& batch() const override { return datagrams; }
+
+private:
+    char* bufferAt(unsigned id) {
+        return buffer_memory.data() + static_cast<size_t>(id) * buffer_size;
+    }
+    
+    void arm() {
+        io_uring_sqe* sqe = acquireSqe(ring);
+        if (!sqe) return;   // still full: stay unarmed and retry on the next receive()
+        io_uring_prep_recvmsg_multishot(sqe, fd, &msg_template, 0);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = buffer_group;
+        armed = true;
+    }
+    
+    void consume(io_uring_cqe* cqe) {
+        // The multishot request ends on error or buffer exhaustion; re-arm next time round
+        if (!(cqe->flags & IORING_CQE_F_MORE)) armed = false;
+        if (cqe->res < 0 || !(cqe->flags & IORING_CQE_F_BUFFER)) return;
+        
+        uint16_t id = static_cast<uint16_t>(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        in_use.push_back(id);
+        
+        auto* out = io_uring_recvmsg_validate(bufferAt(id), cqe->res, &msg_template);
+        if (!out || out->namelen < sizeof(sockaddr_in)) return;
+        
+        Datagram datagram{};
+        std::memcpy(&datagram.source, io_uring_recvmsg_name(out), sizeof(sockaddr_in));
+        datagram.data = static_cast<const char*>(io_uring_recvmsg_payload(out, &msg_template));
+        datagram.length = io_uring_recvmsg_payload_length(out, cqe->res, &msg_template);
+        datagram.truncated = (out->flags & MSG_TRUNC) != 0;
+        for (cmsghdr* cmsg = io_uring_recvmsg_cmsg_firsthdr(out, &msg_template); cmsg != nullptr;
+             cmsg = io_uring_recvmsg_cmsg_nexthdr(out, &msg_template, cmsg)) {
+            ListenerSocket::applyControlMessage(cmsg, datagram.meta);
+        }
+        datagrams.push_back(datagram);
+    }
+    
+    void recycle() {
+        if (in_use.empty()) return;
+        int offset = 0;
+        for (uint16_t id : in_use) {
+            io_uring_buf_ring_add(buf_ring, bufferAt(id), static_cast<unsigned>(buffer_size), id,
+                                  io_uring_buf_ring_mask(buffer_count), offset++);
+        }
+        io_uring_buf_ring_advance(buf_ring, offset);
+        in_use.clear();
+    }
+};
+
+// 💍 Batched SENDMSG SQEs: one io_uring_enter per flush
+class IoUringSendEngine : public SendEngine {
+private:
+    static constexpr unsigned ring_entries = 256;
+    
+    int fd;
+    io_uring ring{};
+    bool initialized{ false };
+    std::vector<sockaddr_in> targets;
+    std::vector<iovec> iovecs;
+    std::vector<msghdr> messages;
+
+public:
+    explicit IoUringSendEngine(int socket_fd) : fd(socket_fd) {
+        initialized = io_uring_queue_init(ring_entries, &ring, 0) == 0;
+    }
+    
+    ~IoUringSendEngine() override {
+        if (initialized) io_uring_queue_exit(&ring);
+    }
+    
+    bool ok() const { return initialized; }
+    
+    EngineKind kind() const override { return EngineKind::IoUring; }
+    
+    void queue(const char* data, size_t length, const sockaddr_in& target) override {
+        targets.push_back(target);
+        iovecs.push_back({ const_cast<char*>(data), length });
+    }
+    
+    size_t flush() override {
+        size_t total = iovecs.size();
+        messages.assign(total, msghdr{});
+        size_t sent = 0;
+        
+        for (size_t start = 0; start < total; start += ring_entries) {
+            size_t count = std::min<size_t>(ring_entries, total - start);
+            size_t queued = 0;
+            for (size_t i = start; i < start + count; ++i) {
+                messages[i].msg_name = &targets[i];
+                messages[i].msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_iov = &iovecs[i];
+                messages[i].msg_iovlen = 1;
+                
+                // A datagram that finds no free entry even after a submit is not sent
+                io_uring_sqe* sqe = acquireSqe(ring);
+                if (!sqe) break;
+                io_uring_prep_sendmsg(sqe, fd, &messages[i], 0);
+                queued++;
+            }
+            
+            io_uring_submit_and_wait(&ring, static_cast<unsigned>(queued));
+            for (size_t reaped = 0; reaped < queued; ++reaped) {
+                io_uring_cqe* cqe = nullptr;
+                if (io_uring_wait_cqe(&ring, &cqe) < 0) break;
+                if (cqe->res >= 0) sent++;
+                io_uring_cqe_seen(&ring, cqe);
+            }
+        }
+        
+        targets.clear();
+        iovecs.clear();
+        return sent;
+    }
+};
+#endif
+
+// 🏭 Factories fall back to the next best engine when one is unavailable
+inline std::unique_ptr<ReceiveEngine> createReceiveEngine(EngineKind kind, int fd, const EngineOptions& options = {}) {
+    #ifdef LIGHTHOUSE_HAVE_LIBURING
+        if (kind == EngineKind::IoUring) {
+            auto engine = std::make_unique<IoUringReceiveEngine>(fd, options);
+            if (engine->ok()) return engine;
+            std::cout << "⚠️  io_uring unavailable on this kernel - falling back to recvmmsg\n";
+        }
+    #else
+        if (kind == EngineKind::IoUring) {
+            std::cout << "⚠️  Built without liburing - falling back to recvmmsg\n";
+        }
+    #endif
+    
+    #ifdef __linux__
+        if (kind != EngineKind::Recvfrom) {
+            return std::make_unique<RecvmmsgEngine>(fd, options);
+        }
+    #endif
+    return std::make_unique<RecvfromEngine>(fd, options);
+}
+
+inline std::unique_ptr<SendEngine> createSendEngine(EngineKind kind, int fd) {
+    #ifdef LIGHTHOUSE_HAVE_LIBURING
+        if (kind == EngineKind::IoUring) {
+            auto engine = std::make_unique<IoUringSendEngine>(fd);
+            if (engine->ok()) return engine;
+            std::cout << "⚠️  io_uring unavailable on this kernel - falling back to sendmmsg\n";
+        }
+    #endif
+    
+    #ifdef __linux__
+        if (kind != EngineKind::Recvfrom) {
+            return std::make_unique<SendmmsgEngine>(fd);
+        }
+    #endif
+    return std::make_unique<SendtoEngine>(fd);
+}
+
+} // namespace DatagramEngine
+
+#endif // DATAGRAM_ENGINE_HPP
@@ -0,0 +1,134 @@
+#ifndef INTERN_TABLE_HPP
+#define INTERN_TABLE_HPP
+
+// 🏷️ Interning tables: dense 32-bit ids for strings and UDP endpoints
+// A lighthouse id or source address is hashed once on first sight; after
+// that every tracker and queue carries the integer, and the text is only
+// produced again when something is displayed. Ids are never recycled, so
+// a name looked up by id stays valid for the life of the table.
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+#endif
+
+namespace Interning {
+
+using InternId = uint32_t;
+
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view text) const noexcept {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
+// 📛 Strings (beacon ids, status labels, versions)
+class StringInternTable {
+private:
+    mutable std::shared_mutex mutex{};
+    std::unordered_map<std::string, InternId, TransparentStringHash, std::equal_to<>> ids{};
+    std::deque<std::string> names{};     // deque: push_back never moves existing names
+
+public:
+    // Hits only take the shared lock; a new string takes the exclusive one once
+    InternId intern(std::string_view text) {
+        {
+            std::shared_lock lock(mutex);
+            auto it = ids.find(text);
+            if (it != ids.end()) return it->second;
+        }
+        
+        std::unique_lock lock(mutex);
+        auto it = ids.find(text);
+        if (it != ids.end()) return it->second;
+        
+        InternId id = static_cast<InternId>(names.size());
+        names.emplace_back(text);
+        ids.emplace(names.back(), id);
+        return id;
+    }
+    
+    std::optional<InternId> find(std::string_view text) const {
+        std::shared_lock lock(mutex);
+        auto it = ids.find(text);
+        if (it == ids.end()) return std::nullopt;
+        return it->second;
+    }
+    
+    std::string_view name(InternId id) const {
+        std::shared_lock lock(mutex);
+        return id < names.size() ? std::string_view{ names[id] } : std::string_view{};
+    }
+    
+    size_t size() const {
+        std::shared_lock lock(mutex);
+        return names.size();
+    }
+};
+
+// 🌐 IPv4 endpoints keyed by raw address + port; formatted with inet_ntop only on display
+class EndpointInternTable {
+private:
+    mutable std::shared_mutex mutex{};
+    std::unordered_map<uint64_t, InternId> ids{};
+    std::deque<sockaddr_in> endpoints{};
+    
+    static uint64_t key(const sockaddr_in& address) {
+        return (static_cast<uint64_t>(address.sin_addr.s_addr) << 16) | address.sin_port;
+    }
+
+public:
+    InternId intern(const sockaddr_in& address) {
+        uint64_t k = key(address);
+        {
+            std::shared_lock lock(mutex);
+            auto it = ids.find(k);
+            if (it != ids.end()) return it->second;
+        }
+        
+        std::unique_lock lock(mutex);
+        auto it = ids.find(k);
+        if (it != ids.end()) return it->second;
+        
+        InternId id = static_cast<InternId>(endpoints.size());
+        endpoints.push_back(address);
+        ids.emplace(k, id);
+        return id;
+    }
+    
+    std::string ip(InternId id) const {
+        sockaddr_in address{};
+        {
+            std::shared_lock lock(mutex);
+            if (id >= endpoints.size()) return {};
+            address = endpoints[id];
+        }
+        
+        char text[INET_ADDRSTRLEN]{};
+        inet_ntop(AF_INET, &address.sin_addr, text, INET_ADDRSTRLEN);
+        return text;
+    }
+    
+    size_t size() const {
+        std::shared_lock lock(mutex);
+        return endpoints.size();
+    }
+};
+
+} // namespace Interning
+
+#endif // INTERN_TABLE_HPP
@@ -10,6 +10,23 @@
 #include <atomic>
 #include <memory>
 #include <sstream>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include <filesystem>
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+#include "perf_counters.hpp"
+#include "ultrafast_beacon_parser.hpp"
+#include "../parser.hpp"
+#include "../structural_index.hpp"
+#include "../ondemand.hpp"
+#include "../tape_dom.hpp"
+#include "../path_query.hpp"
+#include "../json_simple.hpp"
 
 // 🏰 ULTIMATE JSON PERFORMANCE BENCHMARK
 // Showcasing RTC's Jsonifier - The Fastest JSON Library in Existence
@@ -51,6 +68,26 @@ struct NestedPerformanceTest {
     uint64_t timestamp{ 0 };
 };
 
+// 🏰 Wire beacon as sent by ultimate_lighthouse_beacon.cpp
+struct BenchBeaconPayload {
+    jsonifier::string beacon_id{};
+    uint64_t timestamp{ 0 };
+    jsonifier::string status{};
+    jsonifier::string last_ping_status{};
+    double ping_latency_ms{ 0.0 };
+    uint32_t signal_age_seconds{ 0 };
+    double json_parse_time_microseconds{ 0.0 };
+    double json_serialize_time_microseconds{ 0.0 };
+    uint64_t total_requests_processed{ 0 };
+    uint64_t successful_parses{ 0 };
+    uint64_t failed_parses{ 0 };
+    double average_throughput_mbps{ 0.0 };
+    jsonifier::string cpu_optimization_level{};
+    double system_uptime_hours{ 0.0 };
+    uint32_t beacon_sequence_number{ 0 };
+    jsonifier::string lighthouse_version{};
+};
+
 // 🔥 Benchmark Result Structures
 struct BenchmarkResult {
     jsonifier::string test_name{};
@@ -62,6 +99,15 @@ struct BenchmarkResult {
     double throughput_mbps{ 0.0 };
     uint64_t total_bytes{ 0 };
     bool success{ false };
+    // 🔬 Hardware counters for the timed loop (zero when perf counters are unavailable)
+    bool counters_available{ false };
+    uint64_t cycles{ 0 };
+    uint64_t instructions{ 0 };
+    uint64_t branch_misses{ 0 };
+    uint64_t l1d_misses{ 0 };
+    uint64_t llc_misses{ 0 };
+    double ipc{ 0.0 };
+    double cycles_per_byte{ 0.0 };
 };
 
 struct ComprehensiveResults {
@@ -73,18 +119,91 @@ struct ComprehensiveResults {
     double total_benchmark_time_seconds{ 0.0 };
 };
 
+// 📈 One row of a thread-count scaling sweep
+struct ScalingResult {
+    uint32_t threads{ 0 };
+    double total_throughput_mbps{ 0.0 };
+    double per_thread_throughput_mbps{ 0.0 };
+    double speedup{ 0.0 };
+    double efficiency_percent{ 0.0 };
+    double slowest_thread_seconds{ 0.0 };
+};
+
+// 📚 Corpus suite results (written to / read back from JSON for regression gating)
+struct CorpusBenchmarkEntry {
+    jsonifier::string parser{};
+    jsonifier::string document{};
+    jsonifier::string category{};
+    uint64_t document_bytes{ 0 };
+    uint64_t samples{ 0 };
+    uint64_t iterations_per_sample{ 0 };
+    double median_ns{ 0.0 };
+    double p99_ns{ 0.0 };
+    double throughput_mbps{ 0.0 };
+    bool accepted{ false };
+    double ipc{ 0.0 };
+    double cycles_per_byte{ 0.0 };
+    double branch_misses_per_parse{ 0.0 };
+};
+
+struct CorpusBenchmarkReport {
+    jsonifier::string cpu_optimization_level{};
+    int32_t pinned_cpu{ -1 };
+    uint64_t samples_per_entry{ 0 };
+    std::vector<CorpusBenchmarkEntry> entries{};
+};
+
+// 📌 Pin the calling thread to one CPU so runs are comparable across invocations
+inline bool pinCurrentThreadToCpu(int cpu) {
+    #ifdef __linux__
+        if (cpu < 0) return false;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return sched_setaffinity(0, sizeof(set), &set) == 0;
+    #else
+        (void)cpu;
+        return false;
+    #endif
+}
+
+inline int currentCpu() {
+    #ifdef __linux__
+        return sched_getcpu();
+    #else
+        return -1;
+    #endif
+}
+
+// 🧱 Makes the compiler treat value as used, so the work producing it can't be dropped
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+    #else
+        static volatile T observed{};
+        observed = value;
+    #endif
+}
+
 // ⚡ Ultra-High Performance Benchmark Engine
 class UltimateBenchmarkEngine {
 private:
     jsonifier::jsonifier_core<> json_core{};
     std::random_device rd{};
     std::mt19937 gen{ rd() };
+    PerfCounterGroup perf_counters{};
     
 public:
     UltimateBenchmarkEngine() {
         std::cout << "🚀 RTC Jsonifier Ultimate Benchmark Engine Initialized!\n";
         std::cout << "⚡ SIMD Optimization: " << getOptimizationInfo() << "\n";
-        std::cout << "🔥 CPU Features: " << getCPUInfo() << "\n\n";
+        std::cout << "🔥 CPU Features: " << getCPUInfo() << "\n";
+        if (perf_counters.available()) {
+            std::cout << "🔬 Hardware Counters: cycles, instructions, branch/L1D/LLC misses\n\n";
+        } else {
+            std::cout << "🔬 Hardware Counters: unavailable (" << perf_counters.unavailableReason() << ")\n\n";
+        }
     }
     
     // 🔥 Comprehensive parse benchmark
@@ -114,6 +233,7 @@ public:
         }
         
         // Actual benchmark
+        perf_counters.start();
         for (uint64_t i = 0; i < iterations; ++i) {
             auto start = std::chrono::high_resolution_clock::now();
             
@@ -127,6 +247,7 @@ public:
             auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
             times.push_back(duration.count() / 1000.0); // Convert to microseconds
         }
+        PerfSample counters = perf_counters.stop();
         
         auto benchmark_end = std::chrono::high_resolution_clock::now();
         auto total_time = std::chrono::duration_cast<std::chrono::microseconds>(benchmark_end - benchmark_start);
@@ -142,6 +263,7 @@ public:
         double total_seconds = result.total_time_microseconds / 1000000.0;
         double total_mb = result.total_bytes / (1024.0 * 1024.0);
         result.throughput_mbps = total_mb / total_seconds;
+        applyCounters(result, counters);
         
         displayResult(result);
         return result;
@@ -174,6 +296,7 @@ public:
         }
         
         // Actual benchmark
+        perf_counters.start();
         for (uint64_t i = 0; i < iterations; ++i) {
             auto start = std::chrono::high_resolution_clock::now();
             
@@ -189,6 +312,7 @@ public:
             auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
             times.push_back(duration.count() / 1000.0); // Convert to microseconds
         }
+        PerfSample counters = perf_counters.stop();
         
         auto benchmark_end = std::chrono::high_resolution_clock::now();
         auto total_time = std::chrono::duration_cast<std::chrono::microseconds>(benchmark_end - benchmark_start);
@@ -205,6 +329,7 @@ public:
         double total_seconds = result.total_time_microseconds / 1000000.0;
         double total_mb = result.total_bytes / (1024.0 * 1024.0);
         result.throughput_mbps = total_mb / total_seconds;
+        applyCounters(result, counters);
         
         displayResult(result);
         return result;
@@ -231,6 +356,7 @@ public:
         auto benchmark_start = std::chrono::high_resolution_clock::now();
         
         // Actual benchmark
+        perf_counters.start();
         for (uint64_t i = 0; i < iterations; ++i) {
             auto start = std::chrono::high_resolution_clock::now();
             
@@ -249,6 +375,7 @@ public:
             auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
             times.push_back(duration.count() / 1000.0); // Convert to microseconds
         }
+        PerfSample counters = perf_counters.stop();
         
         auto benchmark_end = std::chrono::high_resolution_clock::now();
         auto total_time = std::chrono::duration_cast<std::chrono::microseconds>(benchmark_end - benchmark_start);
@@ -265,6 +392,7 @@ public:
         double total_seconds = result.total_time_microseconds / 1000000.0;
         double total_mb = result.total_bytes / (1024.0 * 1024.0);
         result.throughput_mbps = total_mb / total_seconds;
+        applyCounters(result, counters);
         
         displayResult(result);
         return result;
@@ -339,6 +467,137 @@ public:
         return result;
     }
     
+    // 📈 Scaling sweep: 1, 2, 4 ... N pinned threads, each with its own jsonifier_core.
+    // Every thread walks the whole working set, so a single small document stays in L1
+    // (compute bound) while a working set larger than LLC streams from DRAM (memory bound).
+    template<typename T>
+    std::vector<ScalingResult> scalingSweep(const std::string& test_name,
+                                            const std::vector<std::string>& working_set,
+                                            uint64_t parses_per_thread) {
+        uint32_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<uint32_t> thread_counts;
+        for (uint32_t n = 1; n < max_threads; n *= 2) thread_counts.push_back(n);
+        thread_counts.push_back(max_threads);
+        
+        uint64_t working_set_bytes = 0;
+        for (const auto& doc : working_set) working_set_bytes += doc.size();
+        
+        std::cout << "📈 Scaling sweep: " << test_name << " (" << working_set.size() << " docs, "
+                 << std::fixed << std::setprecision(1) << working_set_bytes / (1024.0 * 1024.0)
+                 << " MB working set, " << parses_per_thread << " parses/thread)\n";
+        
+        std::vector<ScalingResult> results;
+        for (uint32_t thread_count : thread_counts) {
+            std::vector<double> thread_seconds(thread_count, 0.0);
+            std::vector<uint64_t> thread_bytes(thread_count, 0);
+            std::atomic<uint32_t> ready{ 0 };
+            std::atomic<bool> go{ false };
+            std::vector<std::thread> workers;
+            
+            for (uint32_t t = 0; t < thread_count; ++t) {
+                workers.emplace_back([&, t]() {
+                    pinCurrentThreadToCpu(static_cast<int>(t % max_threads));
+                    jsonifier::jsonifier_core<> local_core{};
+                    T test_object{};
+                    
+                    // Stagger start offsets so threads don't all share one hot document
+                    size_t index = (working_set.size() * t) / thread_count;
+                    uint64_t bytes = 0;
+                    
+                    // Hold every thread at the line so spawn cost stays out of the timing
+                    ready.fetch_add(1);
+                    while (!go.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                    
+                    auto start = std::chrono::steady_clock::now();
+                    for (uint64_t i = 0; i < parses_per_thread; ++i) {
+                        const std::string& doc = working_set[index];
+                        try {
+                            local_core.parseJson(test_object, doc);
+                        } catch (...) {
+                            // Throughput only; correctness is covered by the other modes
+                        }
+                        bytes += doc.size();
+                        if (++index == working_set.size()) index = 0;
+                    }
+                    auto end = std::chrono::steady_clock::now();
+                    
+                    thread_seconds[t] = std::chrono::duration<double>(end - start).count();
+                    thread_bytes[t] = bytes;
+                });
+            }
+            
+            while (ready.load() < thread_count) {
+                std::this_thread::yield();
+            }
+            go.store(true, std::memory_order_release);
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            
+            ScalingResult row{};
+            row.threads = thread_count;
+            row.slowest_thread_seconds = *std::max_element(thread_seconds.begin(), thread_seconds.end());
+            
+            uint64_t total_bytes = 0;
+            for (uint64_t bytes : thread_bytes) total_bytes += bytes;
+            if (row.slowest_thread_seconds > 0.0) {
+                row.total_throughput_mbps = (total_bytes / (1024.0 * 1024.0)) / row.slowest_thread_seconds;
+            }
+            row.per_thread_throughput_mbps = row.total_throughput_mbps / thread_count;
+            
+            double single_thread = results.empty() ? row.total_throughput_mbps : results.front().total_throughput_mbps;
+            if (single_thread > 0.0) {
+                row.speedup = row.total_throughput_mbps / single_thread;
+                row.efficiency_percent = row.speedup / thread_count * 100.0;
+            }
+            results.push_back(row);
+        }
+        
+        displayScaling(results);
+        return results;
+    }
+    
+    void displayScaling(const std::vector<ScalingResult>& results) {
+        std::cout << "   " << std::left << std::setw(10) << "Threads"
+                 << std::setw(14) << "Total MB/s"
+                 << std::setw(17) << "Per-Thread MB/s"
+                 << std::setw(10) << "Speedup"
+                 << "Efficiency\n";
+        for (const auto& row : results) {
+            std::cout << "   " << std::left << std::setw(10) << row.threads
+                     << std::setw(14) << std::fixed << std::setprecision(1) << row.total_throughput_mbps
+                     << std::setw(17) << std::fixed << std::setprecision(1) << row.per_thread_throughput_mbps
+                     << std::setw(10) << std::fixed << std::setprecision(2) << row.speedup
+                     << std::fixed << std::setprecision(1) << row.efficiency_percent << "%"
+                     << (row.threads > 1 && row.efficiency_percent < 70.0 ? "  ⚠️ scaling wall" : "") << "\n";
+        }
+        std::cout << "\n";
+    }
+    
+    // 🧪 Many distinct complex documents totalling ~target_bytes, well past any LLC
+    std::vector<std::string> generateMemoryBoundWorkingSet(size_t target_bytes = 64 * 1024 * 1024) {
+        std::vector<std::string> working_set;
+        std::uniform_int_distribution<int> octet(1, 254);
+        std::uniform_real_distribution<double> latency(0.1, 500.0);
+        
+        size_t total = 0;
+        while (total < target_bytes) {
+            std::ostringstream json;
+            json << R"({"status":"ok","connecting_ip":"10.)" << octet(gen) << "." << octet(gen) << "." << octet(gen)
+                 << R"(","anonymity_level":"high","speed_hint":"fast","server_processing_latency_ms":)" << latency(gen)
+                 << R"(,"client_ip_from_headers":"203.0.113.)" << octet(gen)
+                 << R"(","message":"working set document )" << working_set.size()
+                 << R"(","additional_headers":["X-Forwarded-For","X-Real-IP","User-Agent"])"
+                 << R"(,"metadata":{"region":"region-)" << octet(gen)
+                 << R"(","datacenter":"primary","load_balancer":"nginx-)" << octet(gen) << R"("}})";
+            working_set.push_back(json.str());
+            total += working_set.back().size();
+        }
+        return working_set;
+    }
+    
     // 🧪 Generate test data
     std::string generateSimpleFastPingJson() {
         return R"({
@@ -407,9 +666,29 @@ private:
                  << result.max_time_microseconds << "µs\n";
         std::cout << "      Throughput: " << std::fixed << std::setprecision(1) 
                  << result.throughput_mbps << " MB/s\n";
+        if (result.counters_available) {
+            std::cout << "      IPC: " << std::fixed << std::setprecision(2) << result.ipc
+                     << "  Cycles/Byte: " << std::fixed << std::setprecision(2) << result.cycles_per_byte << "\n";
+            std::cout << "      Per Iteration: " << std::fixed << std::setprecision(1)
+                     << static_cast<double>(result.branch_misses) / result.iterations << " branch-miss, "
+                     << static_cast<double>(result.l1d_misses) / result.iterations << " L1D-miss, "
+                     << static_cast<double>(result.llc_misses) / result.iterations << " LLC-miss\n";
+        }
         std::cout << "      Success: " << (result.success ? "✅" : "❌") << "\n\n";
     }
     
+    static void applyCounters(BenchmarkResult& result, const PerfSample& counters) {
+        if (!counters.available) return;
+        result.counters_available = true;
+        result.cycles = counters.cycles;
+        result.instructions = counters.instructions;
+        result.branch_misses = counters.branch_misses;
+        result.l1d_misses = counters.l1d_misses;
+        result.llc_misses = counters.llc_misses;
+        result.ipc = counters.ipc();
+        result.cycles_per_byte = counters.cyclesPerByte(result.total_bytes);
+    }
+    
     std::string getOptimizationInfo() {
         #if JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX512)
             return "AVX-512 + AVX2 + BMI2 (MAXIMUM POWER!)";
@@ -451,6 +730,294 @@ private:
     }
 };
 
+// 📚 One captured payload from the corpus directory
+struct CorpusDocument {
+    std::string name;       // e.g. "small/beacon_healthy.json"
+    std::string category;   // small | large | malformed
+    std::string kind;       // beacon | fastping (from the file name prefix)
+    std::string json;
+};
+
+struct CorpusSuiteOptions {
+    std::string corpus_dir{ "bench_corpus" };
+    std::string output_path{};
+    std::string baseline_path{};
+    double regression_threshold_percent{ 10.0 };
+    uint64_t samples{ 2000 };
+    int cpu{ -1 };   // -1 = stay on whichever CPU we start on
+};
+
+// 🏁 Head-to-head corpus benchmark of every JSON parser we ship
+class CorpusBenchmarkSuite {
+private:
+    struct ParserContestant {
+        std::string name;
+        std::function<bool(const CorpusDocument&)> parse;
+    };
+    
+    jsonifier::jsonifier_core<> json_core{};
+    UltraFastBeaconParser beacon_parser{};
+    OnDemand::Document on_demand_document{};
+    TapeDom::Document tape_document{};
+    PathQuery::Query<"beacon_id", "status", "beacon_sequence_number"> beacon_query{};
+    std::vector<ParserContestant> contestants{};
+    PerfCounterGroup perf_counters{};
+    
+    // Each sample must span at least this long so clock overhead stays out of the percentiles
+    static constexpr double min_sample_ns = 5000.0;
+    static constexpr uint64_t max_iterations_per_sample = 1 << 16;
+    
+public:
+    CorpusBenchmarkSuite() {
+        contestants.push_back({ "jsonifier", [this](const CorpusDocument& doc) {
+            try {
+                if (doc.kind == "beacon") {
+                    BenchBeaconPayload payload{};
+                    return static_cast<bool>(json_core.parseJson(payload, doc.json));
+                }
+                ComplexFastPingResponse response{};
+                return static_cast<bool>(json_core.parseJson(response, doc.json));
+            } catch (...) {
+                return false;
+            }
+        } });
+        
+        contestants.push_back({ "parser_t", [](const CorpusDocument& doc) {
+            Tokenizer tokenizer(doc.json);
+            Parser<std::map<std::string, std::string>> parser(tokenizer);
+            std::map<std::string, std::string> fields;
+            return parser.parse(fields);
+        } });
+        
+        contestants.push_back({ "ultrafast_beacon", [this](const CorpusDocument& doc) {
+            BeaconData beacon;
+            return beacon_parser.parseBeaconPayload(doc.json, beacon);
+        } });
+        
+        // The tracker's hot fields only; everything else stays undecoded
+        contestants.push_back({ "ondemand_beacon", [this](const CorpusDocument& doc) {
+            std::string_view beacon_id, status;
+            uint32_t sequence = 0;
+            if (!on_demand_document.load(doc.json) || !on_demand_document.getString("beacon_id", beacon_id)) {
+                return false;
+            }
+            on_demand_document.getString("status", status);
+            on_demand_document.getNumber("beacon_sequence_number", sequence);
+            return true;
+        } });
+        
+        // Same three fields as a compile-time path query: stops once all are found
+        contestants.push_back({ "path_query_beacon", [this](const CorpusDocument& doc) {
+            std::string_view beacon_id, status;
+            uint32_t sequence = 0;
+            if (!beacon_query.run(doc.json) || !beacon_query.get<"beacon_id">(beacon_id)) return false;
+            beacon_query.get<"status">(status);
+            beacon_query.get<"beacon_sequence_number">(sequence);
+            return true;
+        } });
+        
+        // Full schemaless parse: every value on the tape, every string unescaped
+        contestants.push_back({ "tape_dom", [this](const CorpusDocument& doc) {
+            return tape_document.load(doc.json).ok();
+        } });
+        
+        contestants.push_back({ "json_simple", [](const CorpusDocument& doc) {
+            return !parse_json_simple(doc.json).empty();
+        } });
+    }
+    
+    // 📂 Load <dir>/{small,large,malformed}/*.json, sorted for a stable report order
+    static std::vector<CorpusDocument> loadCorpus(const std::string& corpus_dir) {
+        namespace fs = std::filesystem;
+        std::vector<CorpusDocument> documents;
+        
+        for (const char* category : { "small", "large", "malformed" }) {
+            fs::path dir = fs::path(corpus_dir) / category;
+            if (!fs::is_directory(dir)) continue;
+            
+            std::vector<fs::path> files;
+            for (const auto& entry : fs::directory_iterator(dir)) {
+                if (entry.is_regular_file()) files.push_back(entry.path());
+            }
+            std::sort(files.begin(), files.end());
+            
+            for (const auto& file : files) {
+                std::ifstream in(file, std::ios::binary);
+                CorpusDocument doc;
+                doc.name = std::string(category) + "/" + file.filename().string();
+                doc.category = category;
+                doc.kind = file.filename().string().rfind("fastping", 0) == 0 ? "fastping" : "beacon";
+                doc.json.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                documents.push_back(std::move(doc));
+            }
+        }
+        
+        return documents;
+    }
+    
+    CorpusBenchmarkReport run(const std::vector<CorpusDocument>& corpus, const CorpusSuiteOptions& options) {
+        CorpusBenchmarkReport report{};
+        report.samples_per_entry = options.samples;
+        
+        if (options.cpu >= 0 && !pinCurrentThreadToCpu(options.cpu)) {
+            std::cout << "⚠️  Could not pin to CPU " << options.cpu << " - results may be noisy\n";
+        }
+        int cpu = currentCpu();
+        if (pinCurrentThreadToCpu(cpu)) {
+            report.pinned_cpu = cpu;
+            std::cout << "📌 Pinned benchmark thread to CPU " << cpu << "\n";
+        }
+        std::cout << "🧭 parser_t structural index kernel: "
+                 << StructuralIndex::kernelName(StructuralIndex::activeKernel()) << "\n\n";
+        
+        for (const auto& doc : corpus) {
+            for (const auto& contestant : contestants) {
+                report.entries.push_back(measure(contestant, doc, options.samples));
+            }
+        }
+        
+        return report;
+    }
+    
+    static void displayReport(const CorpusBenchmarkReport& report) {
+        std::cout << std::left << std::setw(18) << "Parser"
+                 << std::setw(38) << "Document"
+                 << std::setw(8) << "Bytes"
+                 << std::setw(12) << "Median ns"
+                 << std::setw(12) << "p99 ns"
+                 << std::setw(12) << "MB/s"
+                 << std::setw(8) << "IPC"
+                 << std::setw(10) << "Cyc/B"
+                 << "OK" << "\n";
+        std::cout << std::string(122, '-') << "\n";
+        
+        for (const auto& entry : report.entries) {
+            std::cout << std::left << std::setw(18) << entry.parser
+                     << std::setw(38) << entry.document
+                     << std::setw(8) << entry.document_bytes
+                     << std::setw(12) << std::fixed << std::setprecision(1) << entry.median_ns
+                     << std::setw(12) << std::fixed << std::setprecision(1) << entry.p99_ns
+                     << std::setw(12) << std::fixed << std::setprecision(1) << entry.throughput_mbps
+                     << std::setw(8) << std::fixed << std::setprecision(2) << entry.ipc
+                     << std::setw(10) << std::fixed << std::setprecision(2) << entry.cycles_per_byte
+                     << (entry.accepted ? "✅" : "❌") << "\n";
+        }
+        std::cout << "\n";
+    }
+    
+    bool saveReport(const CorpusBenchmarkReport& report, const std::string& path) {
+        std::string json;
+        json_core.serializeJson(report, json);
+        
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "🚨 Failed to write results to " << path << "\n";
+            return false;
+        }
+        out << json;
+        std::cout << "💾 Results written to " << path << "\n";
+        return true;
+    }
+    
+    // 🚦 Returns the number of (parser, document) pairs whose median regressed past the threshold
+    int compareAgainstBaseline(const CorpusBenchmarkReport& current, const std::string& baseline_path,
+                               double threshold_percent) {
+        std::ifstream in(baseline_path, std::ios::binary);
+        if (!in.is_open()) {
+            std::cerr << "🚨 Baseline not found: " << baseline_path << "\n";
+            return -1;
+        }
+        std::string json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        
+        CorpusBenchmarkReport baseline{};
+        if (!json_core.parseJson(baseline, json)) {
+            std::cerr << "🚨 Baseline is not a valid results file: " << baseline_path << "\n";
+            return -1;
+        }
+        
+        std::map<std::pair<std::string, std::string>, const CorpusBenchmarkEntry*> baseline_index;
+        for (const auto& entry : baseline.entries) {
+            baseline_index[{ std::string(entry.parser), std::string(entry.document) }] = &entry;
+        }
+        
+        std::cout << "🚦 Comparing against " << baseline_path
+                 << " (threshold " << std::fixed << std::setprecision(1) << threshold_percent << "%)\n";
+        
+        int regressions = 0;
+        for (const auto& entry : current.entries) {
+            auto it = baseline_index.find({ std::string(entry.parser), std::string(entry.document) });
+            if (it == baseline_index.end() || it->second->median_ns <= 0.0) continue;
+            
+            double change = (entry.median_ns - it->second->median_ns) / it->second->median_ns * 100.0;
+            if (change > threshold_percent) {
+                ++regressions;
+                std::cout << "   ❌ " << entry.parser << " on " << entry.document << ": "
+                         << std::fixed << std::setprecision(1) << it->second->median_ns << "ns -> "
+                         << entry.median_ns << "ns (+" << change << "%)\n";
+            }
+        }
+        
+        if (regressions == 0) {
+            std::cout << "   ✅ No regressions\n";
+        }
+        std::cout << "\n";
+        return regressions;
+    }
+    
+private:
+    CorpusBenchmarkEntry measure(const ParserContestant& contestant, const CorpusDocument& doc, uint64_t samples) {
+        using clock = std::chrono::steady_clock;
+        
+        CorpusBenchmarkEntry entry{};
+        entry.parser = contestant.name;
+        entry.document = doc.name;
+        entry.category = doc.category;
+        entry.document_bytes = doc.json.size();
+        entry.samples = samples;
+        entry.accepted = contestant.parse(doc);
+        
+        auto timeBatch = [&](uint64_t iterations) {
+            auto start = clock::now();
+            for (uint64_t i = 0; i < iterations; ++i) {
+                doNotOptimize(contestant.parse(doc));
+            }
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+        };
+        
+        // Calibrate the batch size (also serves as warm-up)
+        uint64_t batch = 1;
+        while (batch < max_iterations_per_sample && timeBatch(batch) < min_sample_ns) {
+            batch *= 2;
+        }
+        entry.iterations_per_sample = batch;
+        
+        std::vector<double> per_iteration_ns;
+        per_iteration_ns.reserve(samples);
+        perf_counters.start();
+        for (uint64_t i = 0; i < samples; ++i) {
+            per_iteration_ns.push_back(timeBatch(batch) / batch);
+        }
+        PerfSample counters = perf_counters.stop();
+        
+        if (counters.available) {
+            uint64_t parses = samples * batch;
+            entry.ipc = counters.ipc();
+            entry.cycles_per_byte = counters.cyclesPerByte(parses * doc.json.size());
+            entry.branch_misses_per_parse = static_cast<double>(counters.branch_misses) / parses;
+        }
+        std::sort(per_iteration_ns.begin(), per_iteration_ns.end());
+        
+        if (!per_iteration_ns.empty()) {
+            entry.median_ns = per_iteration_ns[per_iteration_ns.size() / 2];
+            entry.p99_ns = per_iteration_ns[std::min(per_iteration_ns.size() - 1, per_iteration_ns.size() * 99 / 100)];
+        }
+        if (entry.median_ns > 0.0) {
+            entry.throughput_mbps = (doc.json.size() / (1024.0 * 1024.0)) / (entry.median_ns / 1e9);
+        }
+        return entry;
+    }
+};
+
 // 🎯 Comprehensive Benchmark Runner
 class ComprehensiveBenchmarkRunner {
 private:
@@ -560,6 +1127,45 @@ public:
         engine->stressTest<SimpleFastPingResponse>("Stress Test", simple_json, 500000, 16);
     }
     
+    // 📈 Scaling sweep for compute-bound vs memory-bound payloads
+    void runScalingSweep() {
+        std::cout << "📈 Running Multi-Core Scaling Sweep...\n\n";
+        
+        std::vector<std::string> compute_bound{ engine->generateSimpleFastPingJson() };
+        engine->scalingSweep<SimpleFastPingResponse>("Compute-bound (single hot document)", compute_bound, 200000);
+        
+        auto memory_bound = engine->generateMemoryBoundWorkingSet();
+        engine->scalingSweep<ComplexFastPingResponse>("Memory-bound (64 MB distinct documents)", memory_bound,
+                                                     memory_bound.size());
+    }
+    
+    // 📚 Corpus suite: returns a process exit code (non-zero on regression vs baseline)
+    int runCorpusSuite(const CorpusSuiteOptions& options) {
+        std::cout << "📚 Running Corpus Benchmark Suite (" << options.corpus_dir << ")...\n\n";
+        
+        auto corpus = CorpusBenchmarkSuite::loadCorpus(options.corpus_dir);
+        if (corpus.empty()) {
+            std::cerr << "🚨 No corpus documents found under " << options.corpus_dir << "\n";
+            return 1;
+        }
+        
+        CorpusBenchmarkSuite suite;
+        auto report = suite.run(corpus, options);
+        CorpusBenchmarkSuite::displayReport(report);
+        
+        if (!options.output_path.empty() && !suite.saveReport(report, options.output_path)) {
+            return 1;
+        }
+        
+        if (!options.baseline_path.empty()) {
+            int regressions = suite.compareAgainstBaseline(report, options.baseline_path,
+                                                           options.regression_threshold_percent);
+            if (regressions != 0) return 2;
+        }
+        
+        return 0;
+    }
+    
 private:
     void displayFinalResults(const ComprehensiveResults& results) {
         std::cout << R"(
@@ -620,8 +1226,10 @@ private:
                  << std::setw(12) << "Min (µs)" 
                  << std::setw(12) << "Max (µs)"
                  << std::setw(15) << "Throughput"
+                 << std::setw(8) << "IPC"
+                 << std::setw(10) << "Cyc/B"
                  << std::setw(10) << "Success" << "\n";
-        std::cout << std::string(80, '-') << "\n";
+        std::cout << std::string(98, '-') << "\n";
         
         for (const auto& result : results) {
             std::cout << std::left << std::setw(20) << result.test_name.substr(0, 19)
@@ -629,6 +1237,8 @@ private:
                      << std::setw(12) << std::fixed << std::setprecision(2) << result.min_time_microseconds
                      << std::setw(12) << std::fixed << std::setprecision(2) << result.max_time_microseconds
                      << std::setw(15) << (std::to_string(static_cast<int>(result.throughput_mbps)) + " MB/s")
+                     << std::setw(8) << std::fixed << std::setprecision(2) << result.ipc
+                     << std::setw(10) << std::fixed << std::setprecision(2) << result.cycles_per_byte
                      << std::setw(10) << (result.success ? "✅" : "❌") << "\n";
         }
     }
@@ -644,15 +1254,18 @@ void displayMenu() {
    2. Quick Performance Test
    3. Stress Test (High Load)
    4. CPU Feature Test
-   5. Save Results to File
-   6. Exit
+   5. Corpus Suite (save results to lighthouse_bench_results.json)
+   6. Multi-Core Scaling Sweep
+   7. Exit
 
-Enter your choice (1-6): )";
+Enter your choice (1-7): )";
 }
 
 void runCPUFeatureTest() {
     std::cout << "\n🔍 CPU FEATURE DETECTION:\n";
     std::cout << "═══════════════════════════════════════════════════════════════════\n";
+    std::cout << "🧬 Runtime SIMD kernels: " << CpuDispatch::describeSelection() << "\n";
+    std::cout << "   (compile-time checks below describe the build, not necessarily this host)\n";
     
     #if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_POPCNT)
         std::cout << "✅ POPCNT instruction support detected\n";
@@ -729,6 +1342,37 @@ int main(int argc, char* argv[]) {
                 UltimateBenchmark::ComprehensiveBenchmarkRunner runner;
                 runner.runStressTest();
                 return 0;
+            } else if (arg == "--scaling" || arg == "-m") {
+                UltimateBenchmark::ComprehensiveBenchmarkRunner runner;
+                runner.runScalingSweep();
+                return 0;
+            } else if (arg == "--corpus" || arg == "-c") {
+                // --corpus [DIR] [--json OUT] [--compare BASELINE] [--threshold PCT] [--samples N] [--cpu N]
+                UltimateBenchmark::CorpusSuiteOptions options;
+                int i = 2;
+                if (i < argc && argv[i][0] != '-') {
+                    options.corpus_dir = argv[i++];
+                }
+                for (; i < argc; i += 2) {
+                    std::string option = argv[i];
+                    if (i + 1 >= argc) {
+                        std::cerr << "❌ Error: " << option << " requires a value\n";
+                        return 1;
+                    }
+                    std::string value = argv[i + 1];
+                    if (option == "--json") options.output_path = value;
+                    else if (option == "--compare") options.baseline_path = value;
+                    else if (option == "--threshold") options.regression_threshold_percent = std::stod(value);
+                    else if (option == "--samples") options.samples = std::stoull(value);
+                    else if (option == "--cpu") options.cpu = std::stoi(value);
+                    else {
+                        std::cerr << "❌ Unknown corpus option: " << option << "\n";
+                        return 1;
+                    }
+                }
+                
+                UltimateBenchmark::ComprehensiveBenchmarkRunner runner;
+                return runner.runCorpusSuite(options);
             }
         }
         
@@ -755,14 +1399,20 @@ int main(int argc, char* argv[]) {
                 case 4:
                     runCPUFeatureTest();
                     break;
-                case 5:
-                    std::cout << "📝 Results saving not implemented in this demo\n\n";
+                case 5: {
+                    UltimateBenchmark::CorpusSuiteOptions options;
+                    options.output_path = "lighthouse_bench_results.json";
+                    runner.runCorpusSuite(options);
                     break;
+                }
                 case 6:
+                    runner.runScalingSweep();
+                    break;
+                case 7:
                     std::cout << "🏰 Benchmark complete! Thanks for testing RTC's Jsonifier! 🚀\n";
                     return 0;
                 default:
-                    std::cout << "❌ Invalid choice. Please select 1-6.\n\n";
+                    std::cout << "❌ Invalid choice. Please select 1-7.\n\n";
                     break;
             }
         }
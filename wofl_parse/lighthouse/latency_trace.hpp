@@ -0,0 +1,152 @@
+#ifndef LATENCY_TRACE_HPP
+#define LATENCY_TRACE_HPP
+
+// ⏱️ End-to-end beacon latency tracing
+// The lighthouse stamps each stage of a beacon's life in nanoseconds since the
+// Unix epoch; the listener adds its own receive/parse stamps and folds the
+// deltas into per-stage log2 histograms. Stages that cross hosts (network)
+// are only as accurate as the clock sync between them, so negative deltas
+// are counted as skew rather than recorded.
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+namespace LatencyTrace {
+
+inline uint64_t wallClockNanos() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+enum class Stage : uint8_t {
+    Fetch,           // HTTP poll of FastPing
+    FastPingParse,   // fetch end -> lighthouse parse end
+    Hold,            // lighthouse parse end -> beacon send (waiting for the beacon tick)
+    Network,         // send -> kernel receive on the listener
+    SocketQueue,     // kernel receive -> listener wakes up
+    ListenerParse,   // listener wakeup -> listener parse end
+    EndToEnd,        // send -> listener parse end
+    Count
+};
+
+inline const char* stageName(Stage stage) {
+    switch (stage) {
+        case Stage::Fetch: return "Fetch";
+        case Stage::FastPingParse: return "FastPing Parse";
+        case Stage::Hold: return "Hold";
+        case Stage::Network: return "Network";
+        case Stage::SocketQueue: return "Socket Queue";
+        case Stage::ListenerParse: return "Listener Parse";
+        case Stage::EndToEnd: return "End-to-End";
+        default: return "Unknown";
+    }
+}
+
+// 📊 Lock-free log2 histogram: bucket b holds values in [2^(b-1), 2^b) ns
+class Log2Histogram {
+private:
+    static constexpr size_t bucket_count = 64;
+
+    std::array<std::atomic<uint64_t>, bucket_count> buckets{};
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> sum_ns{ 0 };
+    std::atomic<uint64_t> max_ns{ 0 };
+
+public:
+    void record(uint64_t ns) {
+        size_t bucket = static_cast<size_t>(std::bit_width(ns));
+        if (bucket >= bucket_count) bucket = bucket_count - 1;
+
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum_ns.fetch_add(ns, std::memory_order_relaxed);
+
+        uint64_t seen = max_ns.load(std::memory_order_relaxed);
+        while (ns > seen && !max_ns.compare_exchange_weak(seen, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint64_t samples() const { return count.load(std::memory_order_relaxed); }
+    uint64_t maxNanos() const { return max_ns.load(std::memory_order_relaxed); }
+
+    double meanNanos() const {
+        uint64_t n = samples();
+        return n ? static_cast<double>(sum_ns.load(std::memory_order_relaxed)) / n : 0.0;
+    }
+
+    // Upper bound of the bucket holding the given percentile
+    uint64_t percentileNanos(double percentile) const {
+        uint64_t n = samples();
+        if (n == 0) return 0;
+
+        uint64_t target = static_cast<uint64_t>(n * percentile / 100.0);
+        uint64_t seen = 0;
+        for (size_t b = 0; b < bucket_count; ++b) {
+            seen += buckets[b].load(std::memory_order_relaxed);
+            if (seen > target) {
+                return b == 0 ? 0 : (b >= 63 ? UINT64_MAX : (1ULL << b) - 1);
+            }
+        }
+        return maxNanos();
+    }
+};
+
+// 🧭 One histogram per stage, plus a count of deltas that went negative
+class StageHistograms {
+private:
+    std::array<Log2Histogram, static_cast<size_t>(Stage::Count)> stages{};
+    std::atomic<uint64_t> clock_skew_samples{ 0 };
+
+public:
+    // Skips stages whose stamps are missing (0) and counts negative deltas as skew
+    void record(Stage stage, uint64_t from_ns, uint64_t to_ns) {
+        if (from_ns == 0 || to_ns == 0) return;
+        if (to_ns < from_ns) {
+            clock_skew_samples.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        stages[static_cast<size_t>(stage)].record(to_ns - from_ns);
+    }
+
+    const Log2Histogram& get(Stage stage) const {
+        return stages[static_cast<size_t>(stage)];
+    }
+
+    uint64_t clockSkewSamples() const {
+        return clock_skew_samples.load(std::memory_order_relaxed);
+    }
+
+    void display(std::ostream& out) const {
+        out << "   " << std::left << std::setw(17) << "Stage"
+            << std::setw(10) << "Samples"
+            << std::setw(14) << "Mean (µs)"
+            << std::setw(14) << "p50 (µs)"
+            << std::setw(14) << "p99 (µs)"
+            << "Max (µs)\n";
+
+        for (size_t i = 0; i < stages.size(); ++i) {
+            const auto& histogram = stages[i];
+            if (histogram.samples() == 0) continue;
+
+            out << "   " << std::left << std::setw(17) << stageName(static_cast<Stage>(i))
+                << std::setw(10) << histogram.samples()
+                << std::setw(14) << std::fixed << std::setprecision(1) << histogram.meanNanos() / 1000.0
+                << std::setw(14) << std::fixed << std::setprecision(1) << histogram.percentileNanos(50.0) / 1000.0
+                << std::setw(14) << std::fixed << std::setprecision(1) << histogram.percentileNanos(99.0) / 1000.0
+                << std::fixed << std::setprecision(1) << histogram.maxNanos() / 1000.0 << "\n";
+        }
+
+        if (clockSkewSamples() > 0) {
+            out << "   ⚠️  " << clockSkewSamples() << " cross-host deltas were negative (clock skew)\n";
+        }
+    }
+};
+
+} // namespace LatencyTrace
+
+#endif // LATENCY_TRACE_HPP
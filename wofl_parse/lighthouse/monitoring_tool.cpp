@@ -13,7 +13,12 @@
 #include <sstream>
 #include <map>
 #include <set>
+#include <optional>
+#include <algorithm>
+#include <string_view>
+#include <memory_resource>
 #include <cstring>
+#include <cstddef>
 #include <signal.h>
 
 #ifdef _WIN32
@@ -28,6 +33,18 @@
     #include <unistd.h>
 #endif
 
+#include "latency_trace.hpp"
+#include "../listener_socket.hpp"
+#include "../async_logger.hpp"
+#include "../ondemand.hpp"
+#include "../cpu_dispatch.hpp"
+#include "../parse_outcome.hpp"
+#include "datagram_engine.hpp"
+#include "pipeline_ring.hpp"
+#include "intern_table.hpp"
+#include "beacon_status.hpp"
+#include "stats_columns.hpp"
+
 // 🎯 ULTRA-FAST STANDALONE BEACON LISTENER
 // The Ultimate Network Monitoring Companion Tool
 // Powered by RTC's Jsonifier for Maximum Performance
@@ -43,11 +60,14 @@
 namespace StandaloneListener {
 
 // 🚀 Enhanced Beacon Payload Structure (matches lighthouse)
+// Allocator-aware so a whole receive batch can be parsed into one bump arena.
 struct BeaconPayload {
-    jsonifier::string beacon_id{};
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+    
+    std::pmr::string beacon_id{};
     uint64_t timestamp{ 0 };
-    jsonifier::string status{};
-    jsonifier::string last_ping_status{};
+    std::pmr::string status{};
+    std::pmr::string last_ping_status{};
     double ping_latency_ms{ 0.0 };
     uint32_t signal_age_seconds{ 0 };
     
@@ -58,23 +78,87 @@ struct BeaconPayload {
     uint64_t successful_parses{ 0 };
     uint64_t failed_parses{ 0 };
     double average_throughput_mbps{ 0.0 };
-    jsonifier::string cpu_optimization_level{};
+    std::pmr::string cpu_optimization_level{};
     
     // Lighthouse health metrics
     double system_uptime_hours{ 0.0 };
     uint32_t beacon_sequence_number{ 0 };
-    jsonifier::string lighthouse_version{};
+    std::pmr::string lighthouse_version{};
+    
+    // ⏱️ Lighthouse latency trace (ns since Unix epoch, 0 = not traced)
+    uint64_t trace_fetch_start_ns{ 0 };
+    uint64_t trace_fetch_end_ns{ 0 };
+    uint64_t trace_parse_end_ns{ 0 };
+    uint64_t trace_send_ns{ 0 };
     
     // Listener-added metadata
     std::chrono::high_resolution_clock::time_point received_time{};
     double listener_parse_time_microseconds{ 0.0 };
-    jsonifier::string source_ip{};
+    uint64_t kernel_rx_ns{ 0 };       // SO_TIMESTAMPING, 0 when the kernel gave none
+    uint64_t user_rx_ns{ 0 };         // listener woke up with the datagram
+    uint64_t listener_parse_end_ns{ 0 };
+    
+    BeaconPayload() = default;
+    explicit BeaconPayload(const allocator_type& alloc)
+        : beacon_id(alloc), status(alloc), last_ping_status(alloc),
+          cpu_optimization_level(alloc), lighthouse_version(alloc) {}
+};
+
+// 📋 Wire fields of a beacon, for classifying payloads the parser rejects
+inline constexpr std::array<ParseResult::FieldSpec, 20> beacon_payload_schema{ {
+    { "beacon_id", ParseResult::JsonType::String, true },
+    { "timestamp", ParseResult::JsonType::Number },
+    { "status", ParseResult::JsonType::String },
+    { "last_ping_status", ParseResult::JsonType::String },
+    { "ping_latency_ms", ParseResult::JsonType::Number },
+    { "signal_age_seconds", ParseResult::JsonType::Number },
+    { "json_parse_time_microseconds", ParseResult::JsonType::Number },
+    { "json_serialize_time_microseconds", ParseResult::JsonType::Number },
+    { "total_requests_processed", ParseResult::JsonType::Number },
+    { "successful_parses", ParseResult::JsonType::Number },
+    { "failed_parses", ParseResult::JsonType::Number },
+    { "average_throughput_mbps", ParseResult::JsonType::Number },
+    { "cpu_optimization_level", ParseResult::JsonType::String },
+    { "system_uptime_hours", ParseResult::JsonType::Number },
+    { "beacon_sequence_number", ParseResult::JsonType::Number },
+    { "lighthouse_version", ParseResult::JsonType::String },
+    { "trace_fetch_start_ns", ParseResult::JsonType::Number },
+    { "trace_fetch_end_ns", ParseResult::JsonType::Number },
+    { "trace_parse_end_ns", ParseResult::JsonType::Number },
+    { "trace_send_ns", ParseResult::JsonType::Number },
+} };
+
+// 🏷️ Everything the listener interns; parse workers add names, display reads them
+struct BeaconNames {
+    Interning::StringInternTable lighthouses{};
+    Interning::EndpointInternTable sources{};
+    Interning::StringInternTable labels{};      // ping status, CPU level
+};
+
+// 📦 A parsed beacon as it crosses the parse -> aggregate ring: ids and numbers only
+struct BeaconRecord {
+    Interning::InternId lighthouse_id{ 0 };
+    Interning::InternId source_id{ 0 };
+    BeaconStatus::Health status{ BeaconStatus::Health::Unknown };     // decoded once at parse time
+    Interning::InternId last_ping_status{ 0 };
+    Interning::InternId cpu_optimization_level{ 0 };
+    uint64_t timestamp{ 0 };
+    double ping_latency_ms{ 0.0 };
+    uint32_t signal_age_seconds{ 0 };
+    uint32_t beacon_sequence_number{ 0 };
+    double json_parse_time_microseconds{ 0.0 };
+    double average_throughput_mbps{ 0.0 };
+    uint64_t total_requests_processed{ 0 };
+    uint64_t successful_parses{ 0 };
+    uint64_t failed_parses{ 0 };
+    double system_uptime_hours{ 0.0 };
+    double listener_parse_time_microseconds{ 0.0 };
 };
 
 // 📊 Lighthouse Statistics and Health Tracking
 struct LighthouseStats {
-    jsonifier::string lighthouse_id{};
-    jsonifier::string source_ip{};
+    Interning::InternId lighthouse_id{ 0 };
+    Interning::InternId source_id{ 0 };
     uint64_t total_beacons_received{ 0 };
     uint64_t successful_parses{ 0 };
     uint64_t failed_parses{ 0 };
@@ -87,10 +171,10 @@ struct LighthouseStats {
     double average_lighthouse_throughput_mbps{ 0.0 };
     
     // Health tracking
-    std::chrono::high_resolution_clock::time_point first_seen{};
-    std::chrono::high_resolution_clock::time_point last_seen{};
-    std::chrono::high_resolution_clock::time_point last_healthy{};
-    jsonifier::string last_status{};
+    std::chrono::steady_clock::time_point first_seen{};
+    std::chrono::steady_clock::time_point last_seen{};
+    std::chrono::steady_clock::time_point last_healthy{};
+    BeaconStatus::Health last_status{ BeaconStatus::Health::Unknown };
     uint32_t consecutive_healthy{ 0 };
     uint32_t consecutive_warnings{ 0 };
     uint32_t consecutive_critical{ 0 };
@@ -106,10 +190,57 @@ struct LighthouseStats {
     std::vector<uint32_t> recent_sequence_numbers{};
 };
 
+// 🧱 Per-Batch Bump Arena
+// Every string a recv batch produces is carved out of one inline buffer and
+// dropped wholesale once the batch is processed. Anything that does not fit
+// spills to the heap and is counted, so a non-zero overflow count means the
+// steady-state receive path is allocating again.
+class DatagramBatchArena {
+private:
+    class CountingUpstream : public std::pmr::memory_resource {
+    public:
+        std::atomic<uint64_t> allocations{ 0 };
+        
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+    
+    static constexpr size_t arena_bytes = 64 * 1024;
+    
+    alignas(std::max_align_t) std::array<std::byte, arena_bytes> storage{};
+    CountingUpstream upstream{};
+    std::pmr::monotonic_buffer_resource resource{ storage.data(), storage.size(), &upstream };
+    
+public:
+    std::pmr::memory_resource* get() {
+        return &resource;
+    }
+    
+    // Rewinds to the start of the inline buffer; call only once nothing from
+    // the batch is referenced any more.
+    void reset() {
+        resource.release();
+    }
+    
+    uint64_t overflowAllocations() const {
+        return upstream.allocations.load(std::memory_order_relaxed);
+    }
+};
+
 // ⚡ Ultra-High Performance JSON Processor for Listener
 class ListenerJsonProcessor {
 private:
-    jsonifier::jsonifier_core<> core{};
     mutable std::mutex metrics_mutex{};
     
     // Performance tracking
@@ -117,6 +248,7 @@ private:
     std::atomic<uint64_t> successful_parses{ 0 };
     std::atomic<uint64_t> total_bytes_processed{ 0 };
     std::atomic<double> total_parse_time_microseconds{ 0.0 };
+    ParseResult::ParseErrorCounters parse_errors{};
     
 public:
     ListenerJsonProcessor() {
@@ -125,35 +257,59 @@ public:
     }
     
     // 🔥 Parse beacon with comprehensive timing
-    bool parseBeaconWithTiming(BeaconPayload& beacon, const std::string& json_data) {
+    // Never throws: a rejected payload comes back as a failed outcome saying why and where
+    ParseResult::ParseOutcome parseBeaconWithTiming(BeaconPayload& beacon, std::string_view json_data) {
+        // One core per parse worker; jsonifier cores keep internal buffers and are not shareable
+        thread_local jsonifier::jsonifier_core<> core{};
+        
         auto start = std::chrono::high_resolution_clock::now();
+        bool parsed = core.parseJson(beacon, json_data);
+        auto end = std::chrono::high_resolution_clock::now();
         
-        try {
-            auto result = core.parseJson(beacon, json_data);
-            auto end = std::chrono::high_resolution_clock::now();
-            
-            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
-            double microseconds = duration.count() / 1000.0;
-            
-            // Store listener parse time
-            beacon.listener_parse_time_microseconds = microseconds;
-            beacon.received_time = end;
-            
-            // Update metrics
-            total_parses.fetch_add(1);
-            successful_parses.fetch_add(1);
-            total_bytes_processed.fetch_add(json_data.size());
-            
-            // Atomic update of total parse time
-            double expected = total_parse_time_microseconds.load();
-            while (!total_parse_time_microseconds.compare_exchange_weak(expected, expected + microseconds));
-            
-            return true;
-        } catch (const std::exception& e) {
-            total_parses.fetch_add(1);
-            std::cerr << "🚨 Parse Error: " << e.what() << std::endl;
-            return false;
+        if (!parsed) {
+            return recordFailure(json_data);
         }
+        
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double microseconds = duration.count() / 1000.0;
+        
+        // Store listener parse time
+        beacon.listener_parse_time_microseconds = microseconds;
+        beacon.received_time = end;
+        
+        recordSuccess(json_data.size(), microseconds);
+        return ParseResult::ParseOutcome::success();
+    }
+    
+    // Shared with the on-demand path, which times its own parses
+    void recordSuccess(size_t bytes, double microseconds) {
+        total_parses.fetch_add(1);
+        successful_parses.fetch_add(1);
+        total_bytes_processed.fetch_add(bytes);
+        
+        // Atomic update of total parse time
+        double expected = total_parse_time_microseconds.load();
+        while (!total_parse_time_microseconds.compare_exchange_weak(expected, expected + microseconds));
+    }
+    
+    // Works out why json_data was rejected (cold path) and counts it under that kind
+    ParseResult::ParseOutcome recordFailure(std::string_view json_data) {
+        ParseResult::ParseOutcome outcome = ParseResult::diagnose(json_data, beacon_payload_schema);
+        if (outcome.ok()) {
+            outcome = ParseResult::ParseOutcome::failure(ParseResult::ParseErrorKind::Rejected, 0);
+        }
+        recordFailure(outcome.kind);
+        return outcome;
+    }
+    
+    void recordFailure(ParseResult::ParseErrorKind kind) {
+        total_parses.fetch_add(1);
+        parse_errors.record(kind);
+    }
+    
+    // e.g. "truncated 3, unknown key 1"
+    std::string failureSummary() const {
+        return parse_errors.summary();
     }
     
     // 📊 Get listener performance metrics
@@ -192,108 +348,201 @@ public:
     }
     
 private:
+    // Runtime kernels first (what this host is actually running), then Jsonifier's compiled level
     std::string getOptimizationLevel() const {
+        std::string level = "Runtime " + CpuDispatch::describeSelection() + " | Jsonifier build ";
         #if JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX512)
-            return "AVX-512 + AVX2 + BMI2 (MAXIMUM POWER!)";
+            level += "AVX-512";
         #elif JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX2)
-            return "AVX2 + BMI2 (HIGH PERFORMANCE)";
+            level += "AVX2";
         #elif JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX)
-            return "AVX + SIMD (ACCELERATED)";
+            level += "AVX";
         #elif JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_NEON)
-            return "ARM NEON SIMD (ARM OPTIMIZED)";
+            level += "NEON";
         #else
-            return "Fallback Mode (Still Fast!)";
+            level += "baseline";
         #endif
+        return level;
     }
 };
 
 // 🏰 Multi-Lighthouse Tracking and Analytics Engine
+// Hot counters live in struct-of-arrays columns indexed by lighthouse id so
+// the system summary is a handful of vector reductions; everything only the
+// per-lighthouse table needs sits in a parallel vector of cold details.
 class LighthouseTracker {
 private:
-    std::map<std::string, LighthouseStats> lighthouse_stats{};
+    struct LighthouseDetail {
+        Interning::InternId source_id{ 0 };
+        uint64_t successful_parses{ 0 };
+        double average_lighthouse_parse_time_us{ 0.0 };
+        double average_lighthouse_throughput_mbps{ 0.0 };
+        std::chrono::steady_clock::time_point first_seen{};
+        std::chrono::steady_clock::time_point last_seen{};
+        std::chrono::steady_clock::time_point last_healthy{};
+        uint32_t consecutive_healthy{ 0 };
+        uint32_t consecutive_warnings{ 0 };
+        uint32_t consecutive_critical{ 0 };
+        uint32_t last_sequence_number{ 0 };
+        uint64_t sequence_window{ 0 };     // bit i set: last_sequence_number - i has arrived
+        double beacon_loss_percentage{ 0.0 };
+        std::vector<double> recent_parse_times{};
+        std::vector<double> recent_throughputs{};
+        std::vector<uint32_t> recent_sequence_numbers{};
+    };
+    
+    StatsColumns::LighthouseColumns columns{};
+    std::vector<LighthouseDetail> details{};
+    uint64_t tracked_lighthouses{ 0 };
+    const BeaconNames& names;
     mutable std::mutex stats_mutex{};
     std::atomic<uint64_t> total_beacons_received{ 0 };
-    std::chrono::high_resolution_clock::time_point tracker_start_time{};
+    std::chrono::steady_clock::time_point tracker_start_time{};
+    
+    // Parse workers (and the network) can deliver a lighthouse's beacons out of
+    // order. A beacon up to 64 sequence numbers late fills the gap it was counted
+    // in; one this far behind means the lighthouse restarted its sequence.
+    static constexpr uint32_t sequence_window_size = 64;
+    static constexpr uint32_t sequence_restart_distance = 1024;
+    
+    // Counts gaps as the newest sequence number advances and reconciles late arrivals
+    void trackSequence(Interning::InternId id, LighthouseDetail& detail, uint32_t sequence) {
+        if (sequence == 0) return;
+        uint32_t last = detail.last_sequence_number;
+        
+        if (last == 0 || (sequence < last && last - sequence >= sequence_restart_distance)) {
+            detail.last_sequence_number = sequence;
+            detail.sequence_window = 1;
+            return;
+        }
+        
+        if (sequence > last) {
+            uint32_t advance = sequence - last;
+            columns.missed_beacons[id] += advance - 1;
+            detail.sequence_window = advance >= sequence_window_size ? 1 : (detail.sequence_window << advance) | 1;
+            detail.last_sequence_number = sequence;
+            return;
+        }
+        
+        // Late or duplicate: only a first arrival inside the window changes anything
+        uint32_t behind = last - sequence;
+        if (behind >= sequence_window_size) return;
+        uint64_t bit = uint64_t{ 1 } << behind;
+        if (detail.sequence_window & bit) return;
+        detail.sequence_window |= bit;
+        if (columns.missed_beacons[id] > 0) columns.missed_beacons[id]--;
+    }
+    
+    // Reassembles the display view of one lighthouse from its columns and details
+    LighthouseStats snapshot(Interning::InternId id) const {
+        const auto& detail = details[id];
+        LighthouseStats stats{};
+        stats.lighthouse_id = id;
+        stats.source_id = detail.source_id;
+        stats.total_beacons_received = columns.total_beacons[id];
+        stats.successful_parses = detail.successful_parses;
+        stats.average_parse_time_us = columns.average_parse_us[id];
+        stats.min_parse_time_us = columns.min_parse_us[id];
+        stats.max_parse_time_us = columns.max_parse_us[id];
+        stats.average_lighthouse_parse_time_us = detail.average_lighthouse_parse_time_us;
+        stats.average_lighthouse_throughput_mbps = detail.average_lighthouse_throughput_mbps;
+        stats.first_seen = detail.first_seen;
+        stats.last_seen = detail.last_seen;
+        stats.last_healthy = detail.last_healthy;
+        stats.last_status = static_cast<BeaconStatus::Health>(columns.status[id]);
+        stats.consecutive_healthy = detail.consecutive_healthy;
+        stats.consecutive_warnings = detail.consecutive_warnings;
+        stats.consecutive_critical = detail.consecutive_critical;
+        stats.last_sequence_number = detail.last_sequence_number;
+        stats.missed_beacons = columns.missed_beacons[id];
+        stats.beacon_loss_percentage = detail.beacon_loss_percentage;
+        stats.recent_parse_times = detail.recent_parse_times;
+        stats.recent_throughputs = detail.recent_throughputs;
+        stats.recent_sequence_numbers = detail.recent_sequence_numbers;
+        return stats;
+    }
     
 public:
-    LighthouseTracker() {
-        tracker_start_time = std::chrono::high_resolution_clock::now();
+    explicit LighthouseTracker(const BeaconNames& beacon_names) : names(beacon_names) {
+        tracker_start_time = std::chrono::steady_clock::now();
     }
     
     // 📊 Update lighthouse statistics
-    void updateStats(const BeaconPayload& beacon) {
+    void updateStats(const BeaconRecord& beacon) {
         std::lock_guard<std::mutex> lock(stats_mutex);
         
-        auto& stats = lighthouse_stats[beacon.beacon_id];
-        auto now = std::chrono::high_resolution_clock::now();
+        const auto id = beacon.lighthouse_id;
+        if (id >= details.size()) {
+            columns.ensure(static_cast<size_t>(id) + 1);
+            details.resize(static_cast<size_t>(id) + 1);
+        }
+        
+        auto& detail = details[id];
+        auto now = std::chrono::steady_clock::now();
+        double parse_time = beacon.listener_parse_time_microseconds;
         
         // Initialize if new lighthouse
-        if (stats.total_beacons_received == 0) {
-            stats.lighthouse_id = beacon.beacon_id;
-            stats.source_ip = beacon.source_ip;
-            stats.first_seen = now;
-            stats.min_parse_time_us = beacon.listener_parse_time_microseconds;
+        if (columns.total_beacons[id] == 0) {
+            detail.source_id = beacon.source_id;
+            detail.first_seen = now;
+            columns.min_parse_us[id] = parse_time;
+            tracked_lighthouses++;
         }
         
         // Update basic stats
-        stats.total_beacons_received++;
-        stats.successful_parses++;
-        stats.last_seen = now;
-        stats.last_status = beacon.status;
+        uint64_t received = ++columns.total_beacons[id];
+        detail.successful_parses++;
+        detail.last_seen = now;
+        columns.last_seen_ns[id] = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        
+        auto health = beacon.status;
+        columns.status[id] = static_cast<uint8_t>(health);
         
         // Update parse time statistics
-        double parse_time = beacon.listener_parse_time_microseconds;
-        stats.average_parse_time_us = ((stats.average_parse_time_us * (stats.total_beacons_received - 1)) + parse_time) / stats.total_beacons_received;
-        stats.min_parse_time_us = std::min(stats.min_parse_time_us, parse_time);
-        stats.max_parse_time_us = std::max(stats.max_parse_time_us, parse_time);
+        columns.average_parse_us[id] = ((columns.average_parse_us[id] * (received - 1)) + parse_time) / received;
+        columns.min_parse_us[id] = std::min(columns.min_parse_us[id], parse_time);
+        columns.max_parse_us[id] = std::max(columns.max_parse_us[id], parse_time);
         
         // Update lighthouse performance stats
-        stats.average_lighthouse_parse_time_us = beacon.json_parse_time_microseconds;
-        stats.average_lighthouse_throughput_mbps = beacon.average_throughput_mbps;
+        detail.average_lighthouse_parse_time_us = beacon.json_parse_time_microseconds;
+        detail.average_lighthouse_throughput_mbps = beacon.average_throughput_mbps;
         
         // Health status tracking
-        if (beacon.status == "healthy") {
-            stats.consecutive_healthy++;
-            stats.consecutive_warnings = 0;
-            stats.consecutive_critical = 0;
-            stats.last_healthy = now;
-        } else if (beacon.status == "warning") {
-            stats.consecutive_warnings++;
-            stats.consecutive_healthy = 0;
-            stats.consecutive_critical = 0;
-        } else if (beacon.status == "critical") {
-            stats.consecutive_critical++;
-            stats.consecutive_healthy = 0;
-            stats.consecutive_warnings = 0;
+        if (health == BeaconStatus::Health::Healthy) {
+            detail.consecutive_healthy++;
+            detail.consecutive_warnings = 0;
+            detail.consecutive_critical = 0;
+            detail.last_healthy = now;
+        } else if (health == BeaconStatus::Health::Warning) {
+            detail.consecutive_warnings++;
+            detail.consecutive_healthy = 0;
+            detail.consecutive_critical = 0;
+        } else if (health == BeaconStatus::Health::Critical) {
+            detail.consecutive_critical++;
+            detail.consecutive_healthy = 0;
+            detail.consecutive_warnings = 0;
         }
         
         // Sequence tracking and beacon loss detection
-        if (stats.last_sequence_number > 0 && beacon.beacon_sequence_number > 0) {
-            uint32_t expected_next = stats.last_sequence_number + 1;
-            if (beacon.beacon_sequence_number > expected_next) {
-                uint32_t missed = beacon.beacon_sequence_number - expected_next;
-                stats.missed_beacons += missed;
-            }
-        }
-        stats.last_sequence_number = beacon.beacon_sequence_number;
+        trackSequence(id, detail, beacon.beacon_sequence_number);
         
         // Calculate beacon loss percentage
-        if (stats.total_beacons_received > 0 && stats.last_sequence_number > 0) {
-            uint32_t total_expected = stats.last_sequence_number - 1; // Adjust for sequence start
+        if (detail.last_sequence_number > 0) {
+            uint32_t total_expected = detail.last_sequence_number - 1; // Adjust for sequence start
             if (total_expected > 0) {
-                stats.beacon_loss_percentage = (double)stats.missed_beacons / total_expected * 100.0;
+                detail.beacon_loss_percentage = (double)columns.missed_beacons[id] / total_expected * 100.0;
             }
         }
         
         // Update recent performance trends (keep last 100)
-        stats.recent_parse_times.push_back(parse_time);
-        stats.recent_throughputs.push_back(beacon.average_throughput_mbps);
-        stats.recent_sequence_numbers.push_back(beacon.beacon_sequence_number);
+        detail.recent_parse_times.push_back(parse_time);
+        detail.recent_throughputs.push_back(beacon.average_throughput_mbps);
+        detail.recent_sequence_numbers.push_back(beacon.beacon_sequence_number);
         
-        if (stats.recent_parse_times.size() > 100) {
-            stats.recent_parse_times.erase(stats.recent_parse_times.begin());
-            stats.recent_throughputs.erase(stats.recent_throughputs.begin());
-            stats.recent_sequence_numbers.erase(stats.recent_sequence_numbers.begin());
+        if (detail.recent_parse_times.size() > 100) {
+            detail.recent_parse_times.erase(detail.recent_parse_times.begin());
+            detail.recent_throughputs.erase(detail.recent_throughputs.begin());
+            detail.recent_sequence_numbers.erase(detail.recent_sequence_numbers.begin());
         }
         
         total_beacons_received.fetch_add(1);
@@ -303,58 +552,65 @@ public:
     std::vector<LighthouseStats> getAllStats() const {
         std::lock_guard<std::mutex> lock(stats_mutex);
         std::vector<LighthouseStats> stats_list;
+        stats_list.reserve(tracked_lighthouses);
         
-        for (const auto& [id, stats] : lighthouse_stats) {
-            stats_list.push_back(stats);
+        for (size_t id = 0; id < columns.size(); ++id) {
+            if (columns.total_beacons[id] > 0) {
+                stats_list.push_back(snapshot(static_cast<Interning::InternId>(id)));
+            }
         }
         
         return stats_list;
     }
     
     // 🔍 Get statistics for specific lighthouse
-    std::optional<LighthouseStats> getStats(const std::string& lighthouse_id) const {
-        std::lock_guard<std::mutex> lock(stats_mutex);
+    std::optional<LighthouseStats> getStats(std::string_view lighthouse_id) const {
+        auto id = names.lighthouses.find(lighthouse_id);
         
-        auto it = lighthouse_stats.find(lighthouse_id);
-        if (it != lighthouse_stats.end()) {
-            return it->second;
+        std::lock_guard<std::mutex> lock(stats_mutex);
+        if (id && *id < columns.size() && columns.total_beacons[*id] > 0) {
+            return snapshot(*id);
         }
         return std::nullopt;
     }
     
+    // A lighthouse this long without a beacon counts as stale in the summary
+    static constexpr std::chrono::seconds stale_after{ 60 };
+    
     // 📈 Get system-wide summary
     struct SystemSummary {
         uint64_t total_lighthouses;
         uint64_t healthy_lighthouses;
         uint64_t warning_lighthouses;
         uint64_t critical_lighthouses;
+        uint64_t stale_lighthouses;        // no beacon for stale_after
         uint64_t total_beacons;
+        uint64_t total_missed_beacons;
         double average_parse_time_us;
         double system_uptime_minutes;
     };
     
+    // Unused slots are zero / Unknown, so whole-column reductions need no filtering
     SystemSummary getSystemSummary() const {
         std::lock_guard<std::mutex> lock(stats_mutex);
         
         SystemSummary summary{};
-        summary.total_lighthouses = lighthouse_stats.size();
+        summary.total_lighthouses = tracked_lighthouses;
         summary.total_beacons = total_beacons_received.load();
+        summary.healthy_lighthouses = columns.countStatus(BeaconStatus::Health::Healthy);
+        summary.warning_lighthouses = columns.countStatus(BeaconStatus::Health::Warning);
+        summary.critical_lighthouses = columns.countStatus(BeaconStatus::Health::Critical);
+        summary.total_missed_beacons = columns.sumMissed();
         
-        double total_parse_time = 0.0;
-        for (const auto& [id, stats] : lighthouse_stats) {
-            total_parse_time += stats.average_parse_time_us;
-            
-            if (stats.last_status == "healthy") summary.healthy_lighthouses++;
-            else if (stats.last_status == "warning") summary.warning_lighthouses++;
-            else if (stats.last_status == "critical") summary.critical_lighthouses++;
-        }
+        auto now = std::chrono::steady_clock::now();
+        auto cutoff = std::chrono::duration_cast<std::chrono::nanoseconds>((now - stale_after).time_since_epoch());
+        summary.stale_lighthouses = columns.countSilentSince(cutoff.count());
         
         if (summary.total_lighthouses > 0) {
-            summary.average_parse_time_us = total_parse_time / summary.total_lighthouses;
+            summary.average_parse_time_us = columns.sumAverageParse() / summary.total_lighthouses;
         }
         
-        auto uptime = std::chrono::duration_cast<std::chrono::minutes>(
-            std::chrono::high_resolution_clock::now() - tracker_start_time);
+        auto uptime = std::chrono::duration_cast<std::chrono::minutes>(now - tracker_start_time);
         summary.system_uptime_minutes = uptime.count();
         
         return summary;
@@ -365,6 +621,7 @@ public:
 class UltimateStandaloneListener {
 private:
     std::unique_ptr<ListenerJsonProcessor> json_processor;
+    std::unique_ptr<BeaconNames> beacon_names;
     std::unique_ptr<LighthouseTracker> lighthouse_tracker;
     
     // Configuration
@@ -378,15 +635,65 @@ private:
     std::thread listener_thread{};
     std::thread stats_thread{};
     
+    // 🧵 Pipeline: receiver -> raw ring -> parse workers -> parsed ring -> aggregator
+    // The receiver only copies bytes into the raw ring, so display and stats
+    // (aggregator side) can never stall recv; a full ring drops and counts instead.
+    // Slots hold the full 8 KiB the listener has always accepted, and the engine
+    // receives into buffers of the same size; anything longer arrives truncated
+    // and is counted as oversize instead of parsed.
+    static constexpr size_t max_pipeline_datagram = 8192;
+    static constexpr size_t raw_ring_capacity = 4096;
+    static constexpr size_t parsed_ring_capacity = 4096;
+    
+    struct RawDatagram {
+        std::array<char, max_pipeline_datagram> data{};
+        size_t length{ 0 };
+        sockaddr_in source{};
+        uint64_t kernel_rx_ns{ 0 };
+        uint64_t user_rx_ns{ 0 };
+    };
+    
+    Pipeline::BoundedRing<RawDatagram> raw_ring{ raw_ring_capacity };
+    Pipeline::BoundedRing<BeaconRecord> parsed_ring{ parsed_ring_capacity };
+    size_t parse_worker_count{ 2 };
+    std::vector<std::unique_ptr<DatagramBatchArena>> worker_arenas{};
+    std::vector<std::thread> parse_threads{};
+    std::thread aggregator_thread{};
+    std::atomic<bool> receiver_done{ false };
+    std::atomic<bool> parsers_done{ false };
+    std::atomic<uint64_t> oversize_datagrams{ 0 };
+    
     // Network
     int socket_fd{ -1 };
     
+    // Datagrams the kernel dropped on a full socket queue (never reached us)
+    ListenerSocket::KernelDropCounter kernel_drops{};
+    int receive_buffer_bytes{ ListenerSocket::default_receive_buffer_bytes };
+    
+    // recvfrom / recvmmsg / io_uring; batch buffers are owned by the engine
+    DatagramEngine::EngineKind engine_kind{ DatagramEngine::EngineKind::Recvmmsg };
+    
+    // Read only the fields the tracker needs instead of materializing a BeaconPayload
+    bool on_demand_parsing{ false };
+    
+    // ⏱️ Per-stage latency from lighthouse fetch through listener parse
+    LatencyTrace::StageHistograms latency_histograms{};
+    
 public:
-    UltimateStandaloneListener(int port = 9876, bool verbose = false, bool stats = false) 
-        : listen_port(port), verbose_mode(verbose), statistics_mode(stats) {
+    UltimateStandaloneListener(int port = 9876, bool verbose = false, bool stats = false,
+                               int rcvbuf_bytes = ListenerSocket::default_receive_buffer_bytes,
+                               DatagramEngine::EngineKind engine = DatagramEngine::EngineKind::Recvmmsg,
+                               size_t parse_workers = 2, bool on_demand = false) 
+        : listen_port(port), verbose_mode(verbose), statistics_mode(stats),
+          parse_worker_count(parse_workers), receive_buffer_bytes(rcvbuf_bytes), engine_kind(engine),
+          on_demand_parsing(on_demand) {
         
         json_processor = std::make_unique<ListenerJsonProcessor>();
-        lighthouse_tracker = std::make_unique<LighthouseTracker>();
+        beacon_names = std::make_unique<BeaconNames>();
+        lighthouse_tracker = std::make_unique<LighthouseTracker>(*beacon_names);
+        for (size_t i = 0; i < parse_worker_count; ++i) {
+            worker_arenas.push_back(std::make_unique<DatagramBatchArena>());
+        }
         
         #ifdef _WIN32
             WSADATA wsaData;
@@ -428,7 +735,11 @@ public:
             return;
         }
         
+        // Kernel receive stamps separate network/queueing delay from our wakeup latency
+        auto tuning = ListenerSocket::configureListenerSocket(socket_fd, receive_buffer_bytes);
+        
         std::cout << "🎯 Ultra-Fast Beacon Listener bound to port " << listen_port << "\n";
+        ListenerSocket::displaySocketTuning(tuning);
         std::cout << "🎧 Listening for lighthouse beacons...\n";
         if (verbose_mode) {
             std::cout << "📊 Verbose mode enabled - showing all beacon details\n";
@@ -438,7 +749,13 @@ public:
         }
         std::cout << "Press Ctrl+C to stop\n\n";
         
-        // Start worker threads
+        // Start pipeline stages downstream-first so nothing is dropped at startup
+        receiver_done.store(false);
+        parsers_done.store(false);
+        aggregator_thread = std::thread(&UltimateStandaloneListener::aggregatorLoop, this);
+        for (size_t i = 0; i < parse_worker_count; ++i) {
+            parse_threads.emplace_back(&UltimateStandaloneListener::parseWorkerLoop, this, i);
+        }
         listener_thread = std::thread(&UltimateStandaloneListener::listenerLoop, this);
         if (statistics_mode) {
             stats_thread = std::thread(&UltimateStandaloneListener::statisticsLoop, this);
@@ -461,6 +778,18 @@ public:
             listener_thread.join();
         }
         
+        // Drain upstream-first: each stage exits once its producer is done and its ring is empty
+        receiver_done.store(true, std::memory_order_release);
+        for (auto& worker : parse_threads) {
+            if (worker.joinable()) worker.join();
+        }
+        parse_threads.clear();
+        
+        parsers_done.store(true, std::memory_order_release);
+        if (aggregator_thread.joinable()) {
+            aggregator_thread.join();
+        }
+        
         if (stats_thread.joinable()) {
             stats_thread.join();
         }
@@ -481,104 +810,293 @@ private:
 )" << std::endl;
     }
     
+    // 📥 Stage 1: receive only - copy each datagram into the raw ring and go straight back to recv
     void listenerLoop() {
-        char buffer[8192];
-        sockaddr_in client_addr{};
-        socklen_t client_len = sizeof(client_addr);
+        DatagramEngine::EngineOptions options{};
+        options.max_datagram_size = max_pipeline_datagram;
+        auto engine = DatagramEngine::createReceiveEngine(engine_kind, socket_fd, options);
+        std::cout << "📥 Receive engine: " << DatagramEngine::engineName(engine->kind())
+                 << " | Parse workers: " << parse_worker_count
+                 << " | Parser: " << (on_demand_parsing ? "on-demand" : "jsonifier") << "\n";
         
         while (running.load()) {
-            ssize_t received = recvfrom(socket_fd, buffer, sizeof(buffer) - 1, 0,
-                                      reinterpret_cast<sockaddr*>(&client_addr), &client_len);
+            size_t received = engine->receive();
+            uint64_t user_rx_ns = LatencyTrace::wallClockNanos();
+            
+            if (received == 0 || !running.load()) continue;
             
-            if (received > 0 && running.load()) {
-                buffer[received] = '\0';
+            for (const auto& datagram : engine->batch()) {
+                kernel_drops.observe(datagram.meta);
                 
-                char client_ip[INET_ADDRSTRLEN];
-                inet_ntop(AF_INET, &client_addr.sin_addr, client_ip, INET_ADDRSTRLEN);
+                // Cut short by the kernel: only part of the JSON arrived, so don't try to parse it
+                if (datagram.truncated) {
+                    oversize_datagrams.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
                 
-                processBeacon(std::string(buffer, received), std::string(client_ip));
+                raw_ring.tryProduce([&](RawDatagram& slot) {
+                    std::memcpy(slot.data.data(), datagram.data, datagram.length);
+                    slot.length = datagram.length;
+                    slot.source = datagram.source;
+                    slot.kernel_rx_ns = datagram.meta.kernel_rx_ns;
+                    slot.user_rx_ns = user_rx_ns;
+                });
             }
         }
     }
     
-    void processBeacon(const std::string& data, const std::string& source_ip) {
-        // 🚀 Parse beacon with ultra-fast RTC Jsonifier
-        BeaconPayload beacon;
-        beacon.source_ip = source_ip;
-        
-        bool success = json_processor->parseBeaconWithTiming(beacon, data);
+    // 🔥 Stage 2: parse raw datagrams into the worker's arena, forward successes to the aggregator
+    void parseWorkerLoop(size_t worker) {
+        DatagramBatchArena& arena = *worker_arenas[worker];
+        Pipeline::IdleBackoff backoff;
         
-        if (success) {
-            // Update lighthouse statistics
-            lighthouse_tracker->updateStats(beacon);
+        while (true) {
+            // Read the flag first: an empty ring after the receiver finished means we're drained
+            bool upstream_done = receiver_done.load(std::memory_order_acquire);
+            
+            bool consumed = raw_ring.tryConsume([&](RawDatagram& raw) {
+                parseDatagram(raw, arena.get());
+            });
             
-            if (verbose_mode) {
-                displayVerboseBeacon(beacon);
+            if (consumed) {
+                // Nothing parsed from this datagram outlives parseDatagram
+                arena.reset();
+                backoff.reset();
+            } else if (upstream_done) {
+                break;
             } else {
-                displayBeaconSummary(beacon);
+                backoff.wait();
             }
+        }
+    }
+    
+    void parseDatagram(const RawDatagram& raw, std::pmr::memory_resource* arena) {
+        std::string_view data{ raw.data.data(), raw.length };
+        
+        if (on_demand_parsing) {
+            parseDatagramOnDemand(raw, data);
+            return;
+        }
+        
+        // 🚀 Parse beacon with ultra-fast RTC Jsonifier
+        BeaconPayload beacon{ BeaconPayload::allocator_type{ arena } };
+        beacon.kernel_rx_ns = raw.kernel_rx_ns;
+        beacon.user_rx_ns = raw.user_rx_ns;
+        
+        ParseResult::ParseOutcome outcome = json_processor->parseBeaconWithTiming(beacon, data);
+        beacon.listener_parse_end_ns = LatencyTrace::wallClockNanos();
+        
+        if (outcome.ok()) {
+            recordLatencyTrace(traceStamps(beacon));
+            
+            // Intern before claiming a ring cell; strings are copied only the first time they're seen
+            BeaconRecord record = makeRecord(beacon, beacon_names->sources.intern(raw.source));
+            parsed_ring.tryProduce([&](BeaconRecord& slot) { slot = record; });
         } else {
-            std::cout << "🚨 Failed to parse beacon from " << source_ip << "\n";
-            if (verbose_mode) {
-                std::cout << "Raw data: " << data << "\n\n";
+            logParseFailure(raw, data, outcome);
+        }
+    }
+    
+    // 🎯 On-demand path: index the datagram, then decode only the fields that are read.
+    // Values are views into the raw ring cell, which stays claimed until we return,
+    // or into the document's arena for strings that carried escapes.
+    void parseDatagramOnDemand(const RawDatagram& raw, std::string_view data) {
+        thread_local OnDemand::Document document{};
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        std::string_view beacon_id;
+        if (!document.load(data) || !document.getString("beacon_id", beacon_id)) {
+            logParseFailure(raw, data, json_processor->recordFailure(data));
+            return;
+        }
+        
+        // What the tracker and the one-line summary need
+        BeaconRecord record{};
+        std::string_view status;
+        document.getString("status", status);
+        record.status = BeaconStatus::decodeHealth(status);
+        document.getNumber("beacon_sequence_number", record.beacon_sequence_number);
+        document.getNumber("json_parse_time_microseconds", record.json_parse_time_microseconds);
+        document.getNumber("average_throughput_mbps", record.average_throughput_mbps);
+        
+        LatencyStamps stamps{};
+        document.getNumber("trace_fetch_start_ns", stamps.fetch_start_ns);
+        document.getNumber("trace_fetch_end_ns", stamps.fetch_end_ns);
+        document.getNumber("trace_parse_end_ns", stamps.parse_end_ns);
+        document.getNumber("trace_send_ns", stamps.send_ns);
+        
+        // The rest is only ever displayed in verbose mode
+        if (verbose_mode) {
+            std::string_view label;
+            if (document.getString("last_ping_status", label)) {
+                record.last_ping_status = beacon_names->labels.intern(label);
+            }
+            if (document.getString("cpu_optimization_level", label)) {
+                record.cpu_optimization_level = beacon_names->labels.intern(label);
             }
+            document.getNumber("timestamp", record.timestamp);
+            document.getNumber("ping_latency_ms", record.ping_latency_ms);
+            document.getNumber("signal_age_seconds", record.signal_age_seconds);
+            document.getNumber("total_requests_processed", record.total_requests_processed);
+            document.getNumber("successful_parses", record.successful_parses);
+            document.getNumber("failed_parses", record.failed_parses);
+            document.getNumber("system_uptime_hours", record.system_uptime_hours);
         }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        record.listener_parse_time_microseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1000.0;
+        json_processor->recordSuccess(data.size(), record.listener_parse_time_microseconds);
+        
+        stamps.kernel_rx_ns = raw.kernel_rx_ns;
+        stamps.user_rx_ns = raw.user_rx_ns;
+        stamps.listener_parse_end_ns = LatencyTrace::wallClockNanos();
+        recordLatencyTrace(stamps);
+        
+        record.lighthouse_id = beacon_names->lighthouses.intern(beacon_id);
+        record.source_id = beacon_names->sources.intern(raw.source);
+        parsed_ring.tryProduce([&](BeaconRecord& slot) { slot = record; });
     }
     
-    void displayBeaconSummary(const BeaconPayload& beacon) {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        auto tm = *std::localtime(&time_t);
+    void logParseFailure(const RawDatagram& raw, std::string_view data, ParseResult::ParseOutcome outcome) {
+        char client_ip[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &raw.source.sin_addr, client_ip, INET_ADDRSTRLEN);
         
-        std::string health_icon = "✅";
-        if (beacon.status == "warning") health_icon = "⚠️ ";
-        if (beacon.status == "critical") health_icon = "❌";
+        AsyncLog::Record log;
+        log << "🚨 Failed to parse beacon from " << client_ip << ": "
+            << ParseResult::errorKindName(outcome.kind) << " at byte " << outcome.offset << "\n";
+        if (verbose_mode) {
+            log << "Raw data: " << data << "\n\n";
+        }
+    }
+    
+    BeaconRecord makeRecord(const BeaconPayload& beacon, Interning::InternId source_id) {
+        BeaconRecord record{};
+        record.lighthouse_id = beacon_names->lighthouses.intern(beacon.beacon_id);
+        record.source_id = source_id;
+        record.status = BeaconStatus::decodeHealth(beacon.status);
+        record.last_ping_status = beacon_names->labels.intern(beacon.last_ping_status);
+        record.cpu_optimization_level = beacon_names->labels.intern(beacon.cpu_optimization_level);
+        record.timestamp = beacon.timestamp;
+        record.ping_latency_ms = beacon.ping_latency_ms;
+        record.signal_age_seconds = beacon.signal_age_seconds;
+        record.beacon_sequence_number = beacon.beacon_sequence_number;
+        record.json_parse_time_microseconds = beacon.json_parse_time_microseconds;
+        record.average_throughput_mbps = beacon.average_throughput_mbps;
+        record.total_requests_processed = beacon.total_requests_processed;
+        record.successful_parses = beacon.successful_parses;
+        record.failed_parses = beacon.failed_parses;
+        record.system_uptime_hours = beacon.system_uptime_hours;
+        record.listener_parse_time_microseconds = beacon.listener_parse_time_microseconds;
+        return record;
+    }
+    
+    // 🏰 Stage 3: the only writer of LighthouseTracker; display happens here, off the receive path
+    void aggregatorLoop() {
+        Pipeline::IdleBackoff backoff;
         
-        std::cout << "📡 [" << std::put_time(&tm, "%H:%M:%S") << "] " 
-                 << health_icon << " " << beacon.beacon_id << " (" << beacon.source_ip << ") "
-                 << "Parse: " << std::fixed << std::setprecision(2) << beacon.listener_parse_time_microseconds << "µs "
-                 << "Seq: #" << beacon.beacon_sequence_number << "\n";
+        while (true) {
+            bool upstream_done = parsers_done.load(std::memory_order_acquire);
+            
+            bool consumed = parsed_ring.tryConsume([&](BeaconRecord& beacon) {
+                lighthouse_tracker->updateStats(beacon);
+                
+                if (verbose_mode) {
+                    displayVerboseBeacon(beacon);
+                } else {
+                    displayBeaconSummary(beacon);
+                }
+            });
+            
+            if (consumed) {
+                backoff.reset();
+            } else if (upstream_done) {
+                break;
+            } else {
+                backoff.wait();
+            }
+        }
+    }
+    
+    // ⏱️ One beacon's trace stamps, whichever parser read them
+    struct LatencyStamps {
+        uint64_t fetch_start_ns{ 0 };
+        uint64_t fetch_end_ns{ 0 };
+        uint64_t parse_end_ns{ 0 };
+        uint64_t send_ns{ 0 };
+        uint64_t kernel_rx_ns{ 0 };
+        uint64_t user_rx_ns{ 0 };
+        uint64_t listener_parse_end_ns{ 0 };
+    };
+    
+    static LatencyStamps traceStamps(const BeaconPayload& beacon) {
+        return { beacon.trace_fetch_start_ns, beacon.trace_fetch_end_ns, beacon.trace_parse_end_ns,
+                 beacon.trace_send_ns, beacon.kernel_rx_ns, beacon.user_rx_ns, beacon.listener_parse_end_ns };
+    }
+    
+    void recordLatencyTrace(const LatencyStamps& stamps) {
+        using LatencyTrace::Stage;
+        
+        // Lighthouse-side stages (untraced beacons leave these stamps at 0 and are skipped)
+        latency_histograms.record(Stage::Fetch, stamps.fetch_start_ns, stamps.fetch_end_ns);
+        latency_histograms.record(Stage::FastPingParse, stamps.fetch_end_ns, stamps.parse_end_ns);
+        latency_histograms.record(Stage::Hold, stamps.parse_end_ns, stamps.send_ns);
+        
+        // Without a kernel stamp the network stage absorbs the socket queue
+        uint64_t arrival_ns = stamps.kernel_rx_ns ? stamps.kernel_rx_ns : stamps.user_rx_ns;
+        latency_histograms.record(Stage::Network, stamps.send_ns, arrival_ns);
+        latency_histograms.record(Stage::SocketQueue, stamps.kernel_rx_ns, stamps.user_rx_ns);
+        latency_histograms.record(Stage::ListenerParse, stamps.user_rx_ns, stamps.listener_parse_end_ns);
+        latency_histograms.record(Stage::EndToEnd, stamps.send_ns, stamps.listener_parse_end_ns);
     }
     
-    void displayVerboseBeacon(const BeaconPayload& beacon) {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        auto tm = *std::localtime(&time_t);
+    // Per-beacon output is one async record: formatted here, written by the log flusher.
+    // Ids turn back into text only at this point.
+    void displayBeaconSummary(const BeaconRecord& beacon) {
+        const char* health_icon = "✅";
+        if (beacon.status == BeaconStatus::Health::Warning) health_icon = "⚠️ ";
+        if (beacon.status == BeaconStatus::Health::Critical) health_icon = "❌";
         
-        std::cout << "\n┌─────────────────────────────────────────┐\n";
-        std::cout << "│ 🚨 LIGHTHOUSE BEACON RECEIVED          │\n";
-        std::cout << "├─────────────────────────────────────────┤\n";
-        std::cout << "│ ID: " << std::left << std::setw(31) << beacon.beacon_id << " │\n";
-        std::cout << "│ Source: " << std::left << std::setw(27) << beacon.source_ip << " │\n";
-        std::cout << "│ Status: " << std::left << std::setw(27) << beacon.status << " │\n";
-        std::cout << "│ Ping Status: " << std::left << std::setw(23) << beacon.last_ping_status << " │\n";
-        std::cout << "│ Ping Latency: " << std::left << std::setw(22) << (std::to_string(beacon.ping_latency_ms) + "ms") << " │\n";
-        std::cout << "│ Signal Age: " << std::left << std::setw(24) << (std::to_string(beacon.signal_age_seconds) + "s") << " │\n";
-        std::cout << "│ Sequence: #" << std::left << std::setw(24) << beacon.beacon_sequence_number << " │\n";
+        AsyncLog::Record() << "📡 [" << AsyncLog::clockText() << "] " 
+                           << health_icon << " " << beacon_names->lighthouses.name(beacon.lighthouse_id)
+                           << " (" << beacon_names->sources.ip(beacon.source_id) << ") "
+                           << "Parse: " << std::fixed << std::setprecision(2) << beacon.listener_parse_time_microseconds << "µs "
+                           << "Seq: #" << beacon.beacon_sequence_number << "\n";
+    }
+    
+    void displayVerboseBeacon(const BeaconRecord& beacon) {
+        const BeaconNames& names = *beacon_names;
+        AsyncLog::Record log;
         
-        auto beacon_time_t = static_cast<std::time_t>(beacon.timestamp);
-        auto beacon_tm = *std::localtime(&beacon_time_t);
-        std::ostringstream timestamp_str;
-        timestamp_str << std::put_time(&beacon_tm, "%Y-%m-%d %H:%M:%S");
-        std::cout << "│ Timestamp: " << std::left << std::setw(25) << timestamp_str.str() << " │\n";
-        std::cout << "└─────────────────────────────────────────┘\n";
+        log << "\n┌─────────────────────────────────────────┐\n";
+        log << "│ 🚨 LIGHTHOUSE BEACON RECEIVED          │\n";
+        log << "├─────────────────────────────────────────┤\n";
+        log << "│ ID: " << std::left << std::setw(31) << names.lighthouses.name(beacon.lighthouse_id) << " │\n";
+        log << "│ Source: " << std::left << std::setw(27) << names.sources.ip(beacon.source_id) << " │\n";
+        log << "│ Status: " << std::left << std::setw(27) << BeaconStatus::healthName(beacon.status) << " │\n";
+        log << "│ Ping Status: " << std::left << std::setw(23) << names.labels.name(beacon.last_ping_status) << " │\n";
+        log << "│ Ping Latency: " << std::left << std::setw(22) << (std::to_string(beacon.ping_latency_ms) + "ms") << " │\n";
+        log << "│ Signal Age: " << std::left << std::setw(24) << (std::to_string(beacon.signal_age_seconds) + "s") << " │\n";
+        log << "│ Sequence: #" << std::left << std::setw(24) << beacon.beacon_sequence_number << " │\n";
+        log << "│ Timestamp: " << std::left << std::setw(25) << AsyncLog::formatDateTime(static_cast<std::time_t>(beacon.timestamp)) << " │\n";
+        log << "└─────────────────────────────────────────┘\n";
         
         // Performance metrics
-        std::cout << "\n🚀 PERFORMANCE METRICS:\n";
-        std::cout << "   Listener Parse: " << std::fixed << std::setprecision(2) 
-                 << beacon.listener_parse_time_microseconds << "µs\n";
-        std::cout << "   Lighthouse Parse: " << std::fixed << std::setprecision(2) 
-                 << beacon.json_parse_time_microseconds << "µs\n";
-        std::cout << "   Lighthouse Throughput: " << std::fixed << std::setprecision(1) 
-                 << beacon.average_throughput_mbps << " MB/s\n";
-        std::cout << "   CPU Optimization: " << beacon.cpu_optimization_level << "\n";
-        std::cout << "   System Uptime: " << std::fixed << std::setprecision(1) 
-                 << beacon.system_uptime_hours << " hours\n";
-        std::cout << "   Total Requests: " << beacon.total_requests_processed << "\n";
-        std::cout << "   Success Rate: " << std::fixed << std::setprecision(1)
-                 << (beacon.successful_parses / (double)std::max(1ULL, beacon.successful_parses + beacon.failed_parses) * 100.0) << "%\n";
+        log << "\n🚀 PERFORMANCE METRICS:\n";
+        log << "   Listener Parse: " << std::fixed << std::setprecision(2) 
+            << beacon.listener_parse_time_microseconds << "µs\n";
+        log << "   Lighthouse Parse: " << std::fixed << std::setprecision(2) 
+            << beacon.json_parse_time_microseconds << "µs\n";
+        log << "   Lighthouse Throughput: " << std::fixed << std::setprecision(1) 
+            << beacon.average_throughput_mbps << " MB/s\n";
+        log << "   CPU Optimization: " << names.labels.name(beacon.cpu_optimization_level) << "\n";
+        log << "   System Uptime: " << std::fixed << std::setprecision(1) 
+            << beacon.system_uptime_hours << " hours\n";
+        log << "   Total Requests: " << beacon.total_requests_processed << "\n";
+        log << "   Success Rate: " << std::fixed << std::setprecision(1)
+            << (beacon.successful_parses / (double)std::max<uint64_t>(1, beacon.successful_parses + beacon.failed_parses) * 100.0) << "%\n";
         
-        std::cout << "\n";
+        log << "\n";
     }
     
     void statisticsLoop() {
@@ -592,6 +1110,9 @@ private:
     }
     
     void displayStatisticsReport() {
+        // Pending beacon records first, so the report isn't interleaved with them
+        AsyncLog::logger().flush();
+        
         auto summary = lighthouse_tracker->getSystemSummary();
         auto listener_metrics = json_processor->getMetrics();
         auto all_stats = lighthouse_tracker->getAllStats();
@@ -606,18 +1127,31 @@ private:
         std::cout << "   Active Lighthouses: " << summary.total_lighthouses << "\n";
         std::cout << "   Healthy: " << summary.healthy_lighthouses << " | ";
         std::cout << "Warning: " << summary.warning_lighthouses << " | ";
-        std::cout << "Critical: " << summary.critical_lighthouses << "\n";
+        std::cout << "Critical: " << summary.critical_lighthouses << " | ";
+        std::cout << "Stale: " << summary.stale_lighthouses << " (silent > " << LighthouseTracker::stale_after.count() << "s)\n";
         std::cout << "   Total Beacons: " << summary.total_beacons << "\n";
+        std::cout << "   Missed Beacons: " << summary.total_missed_beacons << " (sequence gaps)\n";
+        std::cout << "   Kernel Socket Drops: " << kernel_drops.total() << " (receive queue overflow)\n";
         std::cout << "   System Uptime: " << std::fixed << std::setprecision(1) 
                  << summary.system_uptime_minutes << " minutes\n";
         
         std::cout << "\n🚀 LISTENER PERFORMANCE:\n";
         std::cout << "   Parse Success Rate: " << std::fixed << std::setprecision(1) 
                  << listener_metrics.success_rate << "%\n";
+        std::cout << "   Parse Failures: " << json_processor->failureSummary() << "\n";
         std::cout << "   Average Parse Time: " << std::fixed << std::setprecision(2) 
                  << listener_metrics.average_parse_time_us << " microseconds\n";
         std::cout << "   JSON Throughput: " << std::fixed << std::setprecision(1) 
                  << listener_metrics.throughput_mbps << " MB/s\n";
+        std::cout << "   Arena Overflow Allocations: " << arenaOverflowAllocations() << "\n";
+        std::cout << "   Log Records Suppressed/Dropped: " << AsyncLog::logger().suppressedRecords()
+                 << "/" << AsyncLog::logger().droppedRecords() << "\n";
+        
+        std::cout << "\n🧵 PIPELINE:\n";
+        displayPipelineStats();
+        
+        std::cout << "\n⏱️  LATENCY BREAKDOWN:\n";
+        latency_histograms.display(std::cout);
         
         if (!all_stats.empty()) {
             std::cout << "\n🏰 INDIVIDUAL LIGHTHOUSE STATUS:\n";
@@ -631,12 +1165,12 @@ private:
             
             for (const auto& stats : all_stats) {
                 std::string status_icon = "✅";
-                if (stats.last_status == "warning") status_icon = "⚠️ ";
-                if (stats.last_status == "critical") status_icon = "❌";
+                if (stats.last_status == BeaconStatus::Health::Warning) status_icon = "⚠️ ";
+                if (stats.last_status == BeaconStatus::Health::Critical) status_icon = "❌";
                 
-                std::cout << std::left << std::setw(20) << stats.lighthouse_id.substr(0, 19)
-                         << std::setw(16) << stats.source_ip
-                         << std::setw(10) << (status_icon + stats.last_status).substr(0, 9)
+                std::cout << std::left << std::setw(20) << beacon_names->lighthouses.name(stats.lighthouse_id).substr(0, 19)
+                         << std::setw(16) << beacon_names->sources.ip(stats.source_id)
+                         << std::setw(10) << (status_icon + std::string(BeaconStatus::healthName(stats.last_status))).substr(0, 9)
                          << std::setw(12) << stats.total_beacons_received
                          << std::setw(12) << std::fixed << std::setprecision(1) << stats.beacon_loss_percentage
                          << std::setw(15) << std::fixed << std::setprecision(2) << stats.average_parse_time_us << "\n";
@@ -646,7 +1180,33 @@ private:
         std::cout << "🏰 ═══════════════════════════════════════════════════════════════════ 🏰\n";
     }
     
+    uint64_t arenaOverflowAllocations() const {
+        uint64_t total = 0;
+        for (const auto& arena : worker_arenas) {
+            total += arena->overflowAllocations();
+        }
+        return total;
+    }
+    
+    void displayPipelineStats() {
+        auto displayRing = [](const char* stage, const Pipeline::RingStats& ring) {
+            std::cout << "   " << std::left << std::setw(16) << stage
+                     << "Depth: " << ring.depth << "/" << ring.capacity
+                     << " | High Water: " << ring.high_water
+                     << " | Pushed: " << ring.pushed
+                     << " | Dropped: " << ring.dropped << "\n";
+        };
+        
+        displayRing("Receive->Parse", raw_ring.stats());
+        displayRing("Parse->Aggregate", parsed_ring.stats());
+        if (uint64_t oversize = oversize_datagrams.load(std::memory_order_relaxed)) {
+            std::cout << "   Oversize Datagrams Dropped: " << oversize << " (truncated at " << max_pipeline_datagram << " bytes)\n";
+        }
+    }
+    
     void displayShutdownStats() {
+        AsyncLog::logger().flush();
+        
         auto summary = lighthouse_tracker->getSystemSummary();
         auto listener_metrics = json_processor->getMetrics();
         
@@ -655,12 +1215,19 @@ private:
                  << summary.system_uptime_minutes << " minutes\n";
         std::cout << "   Lighthouses Monitored: " << summary.total_lighthouses << "\n";
         std::cout << "   Total Beacons Received: " << summary.total_beacons << "\n";
+        std::cout << "   Total Beacons Missed: " << summary.total_missed_beacons << "\n";
+        std::cout << "   Kernel Socket Drops: " << kernel_drops.total() << "\n";
         std::cout << "   Parse Success Rate: " << std::fixed << std::setprecision(1) 
                  << listener_metrics.success_rate << "%\n";
+        std::cout << "   Parse Failures: " << json_processor->failureSummary() << "\n";
         std::cout << "   Average Parse Time: " << std::fixed << std::setprecision(2) 
                  << listener_metrics.average_parse_time_us << " microseconds\n";
         std::cout << "   Total JSON Throughput: " << std::fixed << std::setprecision(1) 
                  << listener_metrics.throughput_mbps << " MB/s\n";
+        std::cout << "\n🧵 PIPELINE:\n";
+        displayPipelineStats();
+        std::cout << "\n⏱️  LATENCY BREAKDOWN:\n";
+        latency_histograms.display(std::cout);
         std::cout << "🎯 LISTENER SECURED - Thanks for monitoring! 🎯\n\n";
     }
 };
@@ -689,6 +1256,11 @@ OPTIONS:
    -v, --verbose           Enable verbose beacon display mode
    -s, --statistics        Enable detailed statistics reporting
    -i, --interval SECONDS  Statistics report interval (default: 30)
+   -r, --rcvbuf BYTES      Socket receive buffer (default: 4194304)
+   -e, --engine NAME       Receive engine: recvfrom, recvmmsg, io_uring (default: recvmmsg)
+   -w, --workers N         Parse worker threads (default: 2)
+   -l, --log-rate N        Max beacon log lines per second, 0 = unlimited (default: 0)
+   -P, --parser NAME       Beacon parser: jsonifier, ondemand (default: jsonifier)
    -h, --help              Show this help message
 
 EXAMPLES:
@@ -716,6 +1288,11 @@ int main(int argc, char* argv[]) {
         bool verbose = false;
         bool statistics = false;
         int stats_interval = 30;
+        int rcvbuf_bytes = ListenerSocket::default_receive_buffer_bytes;
+        DatagramEngine::EngineKind engine = DatagramEngine::EngineKind::Recvmmsg;
+        int parse_workers = 2;
+        uint64_t log_rate = 0;
+        bool on_demand = false;
         
         // Parse command line arguments
         for (int i = 1; i < argc; ++i) {
@@ -735,6 +1312,39 @@ int main(int argc, char* argv[]) {
                 verbose = true;
             } else if (arg == "-s" || arg == "--statistics") {
                 statistics = true;
+            } else if (arg == "-r" || arg == "--rcvbuf") {
+                if (i + 1 < argc) {
+                    rcvbuf_bytes = std::stoi(argv[++i]);
+                } else {
+                    std::cerr << "❌ Error: --rcvbuf requires a value\n";
+                    return 1;
+                }
+            } else if (arg == "-e" || arg == "--engine") {
+                if (i + 1 >= argc || !DatagramEngine::parseEngineKind(argv[++i], engine)) {
+                    std::cerr << "❌ Error: --engine requires recvfrom, recvmmsg or io_uring\n";
+                    return 1;
+                }
+            } else if (arg == "-w" || arg == "--workers") {
+                if (i + 1 < argc) {
+                    parse_workers = std::stoi(argv[++i]);
+                } else {
+                    std::cerr << "❌ Error: --workers requires a value\n";
+                    return 1;
+                }
+            } else if (arg == "-l" || arg == "--log-rate") {
+                if (i + 1 < argc) {
+                    log_rate = std::stoull(argv[++i]);
+                } else {
+                    std::cerr << "❌ Error: --log-rate requires a value\n";
+                    return 1;
+                }
+            } else if (arg == "-P" || arg == "--parser") {
+                std::string parser = i + 1 < argc ? argv[++i] : "";
+                if (parser != "jsonifier" && parser != "ondemand") {
+                    std::cerr << "❌ Error: --parser requires jsonifier or ondemand\n";
+                    return 1;
+                }
+                on_demand = parser == "ondemand";
             } else if (arg == "-i" || arg == "--interval") {
                 if (i + 1 < argc) {
                     stats_interval = std::stoi(argv[++i]);
@@ -755,6 +1365,11 @@ int main(int argc, char* argv[]) {
             return 1;
         }
         
+        if (parse_workers < 1 || parse_workers > 64) {
+            std::cerr << "❌ Error: Parse workers must be between 1 and 64\n";
+            return 1;
+        }
+        
         if (stats_interval < 5 || stats_interval > 300) {
             std::cerr << "❌ Error: Statistics interval must be between 5 and 300 seconds\n";
             return 1;
@@ -766,9 +1381,11 @@ int main(int argc, char* argv[]) {
         signal(SIGTERM, signalHandler);
         #endif
         
+        AsyncLog::logger().setRateLimit(log_rate);
+        
         // Create and start the ultimate listener
         g_listener = std::make_unique<StandaloneListener::UltimateStandaloneListener>(
-            port, verbose, statistics);
+            port, verbose, statistics, rcvbuf_bytes, engine, static_cast<size_t>(parse_workers), on_demand);
         
         g_listener->start();
         
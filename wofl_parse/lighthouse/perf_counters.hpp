@@ -0,0 +1,180 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+// 🔬 Hardware performance counters around a benchmark loop (Linux perf_event_open).
+// Everything degrades to "unavailable" on other platforms, in containers without
+// PMU access, or when perf_event_paranoid forbids user-space counting.
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace UltimateBenchmark {
+
+struct PerfSample {
+    bool available{ false };
+    uint64_t cycles{ 0 };
+    uint64_t instructions{ 0 };
+    uint64_t branch_misses{ 0 };
+    uint64_t l1d_misses{ 0 };
+    uint64_t llc_misses{ 0 };
+    bool has_branch_misses{ false };
+    bool has_l1d_misses{ false };
+    bool has_llc_misses{ false };
+    bool multiplexed{ false };   // values were scaled because the PMU was shared
+    
+    double ipc() const {
+        return cycles ? static_cast<double>(instructions) / cycles : 0.0;
+    }
+    
+    double cyclesPerByte(uint64_t bytes) const {
+        return bytes ? static_cast<double>(cycles) / bytes : 0.0;
+    }
+};
+
+// ⚡ One counter group (cycles leads) opened for the calling thread
+class PerfCounterGroup {
+private:
+    enum Counter : size_t { Cycles, Instructions, BranchMisses, L1dMisses, LlcMisses, CounterCount };
+    
+    std::array<int, CounterCount> fds{};
+    std::array<uint64_t, CounterCount> ids{};
+    std::string unavailable_reason{};
+
+public:
+    PerfCounterGroup() {
+        fds.fill(-1);
+        
+        #ifdef __linux__
+            constexpr uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D
+                | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            
+            fds[Cycles] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+            if (fds[Cycles] < 0) {
+                unavailable_reason = std::string("perf_event_open: ") + std::strerror(errno);
+                return;
+            }
+            fds[Instructions] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, fds[Cycles]);
+            fds[BranchMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, fds[Cycles]);
+            fds[L1dMisses] = open(PERF_TYPE_HW_CACHE, l1d_read_miss, fds[Cycles]);
+            fds[LlcMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, fds[Cycles]);
+            
+            // IPC is the minimum useful pair; the cache/branch events are optional
+            if (fds[Instructions] < 0) {
+                unavailable_reason = "instructions counter not supported";
+                close();
+                return;
+            }
+            
+            for (size_t i = 0; i < CounterCount; ++i) {
+                if (fds[i] >= 0 && ioctl(fds[i], PERF_EVENT_IOC_ID, &ids[i]) != 0) {
+                    ::close(fds[i]);
+                    fds[i] = -1;
+                }
+            }
+        #else
+            unavailable_reason = "hardware counters need Linux perf_event_open";
+        #endif
+    }
+    
+    ~PerfCounterGroup() {
+        close();
+    }
+    
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+    
+    bool available() const { return fds[Cycles] >= 0; }
+    const std::string& unavailableReason() const { return unavailable_reason; }
+    
+    void start() {
+        #ifdef __linux__
+            if (!available()) return;
+            ioctl(fds[Cycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds[Cycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        #endif
+    }
+    
+    PerfSample stop() {
+        PerfSample sample{};
+        
+        #ifdef __linux__
+            if (!available()) return sample;
+            ioctl(fds[Cycles], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            
+            // PERF_FORMAT_GROUP | ID | TOTAL_TIME_*: nr, enabled, running, { value, id }[nr]
+            struct {
+                uint64_t nr;
+                uint64_t time_enabled;
+                uint64_t time_running;
+                struct { uint64_t value; uint64_t id; } values[CounterCount];
+            } data{};
+            
+            if (::read(fds[Cycles], &data, sizeof(data)) <= 0 || data.time_running == 0) {
+                return sample;
+            }
+            
+            double scale = 1.0;
+            if (data.time_running < data.time_enabled) {
+                scale = static_cast<double>(data.time_enabled) / data.time_running;
+                sample.multiplexed = true;
+            }
+            
+            for (uint64_t i = 0; i < data.nr && i < CounterCount; ++i) {
+                uint64_t value = static_cast<uint64_t>(data.values[i].value * scale);
+                for (size_t c = 0; c < CounterCount; ++c) {
+                    if (fds[c] < 0 || ids[c] != data.values[i].id) continue;
+                    switch (c) {
+                        case Cycles: sample.cycles = value; break;
+                        case Instructions: sample.instructions = value; break;
+                        case BranchMisses: sample.branch_misses = value; sample.has_branch_misses = true; break;
+                        case L1dMisses: sample.l1d_misses = value; sample.has_l1d_misses = true; break;
+                        case LlcMisses: sample.llc_misses = value; sample.has_llc_misses = true; break;
+                    }
+                }
+            }
+            sample.available = sample.cycles != 0;
+        #endif
+        
+        return sample;
+    }
+
+private:
+    #ifdef __linux__
+        static int open(uint32_t type, uint64_t config, int group_fd) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = group_fd == -1 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID
+                | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+        }
+    #endif
+    
+    void close() {
+        #ifdef __linux__
+            for (auto& fd : fds) {
+                if (fd >= 0) ::close(fd);
+                fd = -1;
+            }
+        #endif
+    }
+};
+
+} // namespace UltimateBenchmark
+
+#endif // PERF_COUNTERS_HPP
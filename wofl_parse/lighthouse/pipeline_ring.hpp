@@ -0,0 +1,172 @@
+#ifndef PIPELINE_RING_HPP
+#define PIPELINE_RING_HPP
+
+// 🔁 Bounded lock-free ring for the listener pipeline (Vyukov MPMC queue)
+// Every cell carries a sequence number; producers and consumers claim a
+// position with one CAS and then own the cell until they publish it, so
+// elements are filled and drained in place with no locks and no allocation.
+// A full ring never blocks the producer: the push fails and is counted as a
+// drop, which is what keeps the receive thread ahead of slow downstream stages.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace Pipeline {
+
+// Fixed rather than std::hardware_destructive_interference_size, whose value is ABI-unstable
+constexpr size_t cache_line_size = 64;
+
+// 📊 Per-stage queue counters, safe to read from any thread
+struct RingStats {
+    size_t capacity{ 0 };
+    size_t depth{ 0 };
+    size_t high_water{ 0 };
+    uint64_t pushed{ 0 };
+    uint64_t dropped{ 0 };
+};
+
+template <typename T>
+class BoundedRing {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{ 0 };
+        T value{};
+    };
+    
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    
+    alignas(cache_line_size) std::atomic<size_t> enqueue_pos{ 0 };
+    alignas(cache_line_size) std::atomic<size_t> dequeue_pos{ 0 };
+    alignas(cache_line_size) std::atomic<uint64_t> pushed{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+    std::atomic<size_t> high_water{ 0 };
+    
+    static size_t roundUpToPowerOfTwo(size_t n) {
+        size_t capacity = 2;
+        while (capacity < n) capacity <<= 1;
+        return capacity;
+    }
+
+public:
+    explicit BoundedRing(size_t requested_capacity)
+        : mask(roundUpToPowerOfTwo(requested_capacity) - 1),
+          cells(std::make_unique<Cell[]>(mask + 1)) {
+        for (size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    BoundedRing(const BoundedRing&) = delete;
+    BoundedRing& operator=(const BoundedRing&) = delete;
+    
+    // Claims a free cell and lets fill(T&) write it in place; false (and a drop) when full
+    template <typename Fill>
+    bool tryProduce(Fill&& fill) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        
+        fill(cell->value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        pushed.fetch_add(1, std::memory_order_relaxed);
+        
+        // Consumers may already be past pos when other producers published after us
+        size_t head = dequeue_pos.load(std::memory_order_relaxed);
+        size_t depth_now = pos + 1 > head ? pos + 1 - head : 0;
+        size_t seen = high_water.load(std::memory_order_relaxed);
+        while (depth_now > seen && !high_water.compare_exchange_weak(seen, depth_now, std::memory_order_relaxed)) {
+        }
+        return true;
+    }
+    
+    // Claims the oldest published cell and hands it to use(T&); false when empty
+    template <typename Use>
+    bool tryConsume(Use&& use) {
+        size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        
+        use(cell->value);
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+    
+    bool tryPush(const T& value) {
+        return tryProduce([&](T& slot) { slot = value; });
+    }
+    
+    bool tryPop(T& out) {
+        return tryConsume([&](T& slot) { out = std::move(slot); });
+    }
+    
+    size_t capacity() const { return mask + 1; }
+    
+    // Approximate under concurrency; exact once producers and consumers are idle
+    size_t depth() const {
+        size_t head = dequeue_pos.load(std::memory_order_relaxed);
+        size_t tail = enqueue_pos.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+    
+    RingStats stats() const {
+        RingStats s{};
+        s.capacity = capacity();
+        s.depth = depth();
+        s.high_water = high_water.load(std::memory_order_relaxed);
+        s.pushed = pushed.load(std::memory_order_relaxed);
+        s.dropped = dropped.load(std::memory_order_relaxed);
+        return s;
+    }
+};
+
+// 💤 Consumer backoff: spin briefly, then yield, then sleep so idle stages don't burn a core
+class IdleBackoff {
+private:
+    uint32_t idle_rounds{ 0 };
+
+public:
+    void reset() { idle_rounds = 0; }
+    
+    void wait() {
+        if (idle_rounds < 64) {
+            ++idle_rounds;
+        } else if (idle_rounds < 128) {
+            ++idle_rounds;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+};
+
+} // namespace Pipeline
+
+#endif // PIPELINE_RING_HPP
@@ -0,0 +1,245 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #pragma comment(lib, "ws2_32.lib")
+    #define close closesocket
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+    #include <unistd.h>
+#endif
+
+#include "datagram_engine.hpp"
+#include "../listener_socket.hpp"
+
+// 🏁 RECEIVE ENGINE BENCHMARK
+// Blasts beacon-sized datagrams over loopback from a sender thread and drains
+// them with each receive engine in turn. Reports datagrams/s and how many of
+// the sent datagrams each engine actually got (the rest overflowed the socket
+// queue, which the SO_RXQ_OVFL counter confirms).
+
+namespace EngineBenchmark {
+
+struct BenchmarkOptions {
+    int port{ 19876 };
+    uint64_t datagrams{ 1000000 };
+    size_t payload_bytes{ 420 };       // typical serialized beacon
+    size_t batch_size{ 32 };
+};
+
+struct EngineResult {
+    std::string engine;
+    uint64_t sent{ 0 };
+    uint64_t received{ 0 };
+    uint32_t kernel_drops{ 0 };
+    double seconds{ 0.0 };
+    double datagrams_per_second{ 0.0 };
+};
+
+class ReceiveEngineBenchmark {
+private:
+    BenchmarkOptions options;
+    std::vector<char> payload;
+
+public:
+    explicit ReceiveEngineBenchmark(const BenchmarkOptions& opts)
+        : options(opts), payload(opts.payload_bytes, 'x') {
+        payload.front() = '{';
+        payload.back() = '}';
+    }
+    
+    EngineResult run(DatagramEngine::EngineKind kind) {
+        EngineResult result{};
+        
+        int rx = static_cast<int>(socket(AF_INET, SOCK_DGRAM, 0));
+        int tx = static_cast<int>(socket(AF_INET, SOCK_DGRAM, 0));
+        if (rx < 0 || tx < 0) {
+            throw std::runtime_error("socket creation failed");
+        }
+        
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(options.port));
+        inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+        if (bind(rx, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close(rx);
+            close(tx);
+            throw std::runtime_error("bind failed on port " + std::to_string(options.port));
+        }
+        ListenerSocket::configureListenerSocket(rx);
+        
+        DatagramEngine::EngineOptions engine_options{};
+        engine_options.batch_size = options.batch_size;
+        engine_options.wake_interval = std::chrono::milliseconds(100);
+        auto engine = DatagramEngine::createReceiveEngine(kind, rx, engine_options);
+        auto sender = DatagramEngine::createSendEngine(DatagramEngine::EngineKind::Recvmmsg, tx);
+        result.engine = DatagramEngine::engineName(engine->kind());
+        
+        std::atomic<bool> sending{ true };
+        std::atomic<uint64_t> sent{ 0 };
+        std::thread sender_thread([&]() {
+            uint64_t remaining = options.datagrams;
+            while (remaining > 0) {
+                size_t count = static_cast<size_t>(std::min<uint64_t>(remaining, 64));
+                for (size_t i = 0; i < count; ++i) {
+                    sender->queue(payload.data(), payload.size(), addr);
+                }
+                sent.fetch_add(sender->flush(), std::memory_order_relaxed);
+                remaining -= count;
+            }
+            sending.store(false);
+        });
+        
+        ListenerSocket::KernelDropCounter drops;
+        auto start = std::chrono::steady_clock::now();
+        auto last_datagram = start;
+        
+        // Stop once the sender is done and the queue has been idle for a wake interval
+        while (true) {
+            size_t received = engine->receive();
+            if (received > 0) {
+                last_datagram = std::chrono::steady_clock::now();
+                result.received += received;
+                for (const auto& datagram : engine->batch()) {
+                    drops.observe(datagram.meta);
+                }
+            } else if (!sending.load()) {
+                break;
+            }
+        }
+        
+        sender_thread.join();
+        
+        result.sent = sent.load();
+        result.kernel_drops = drops.total();
+        result.seconds = std::chrono::duration<double>(last_datagram - start).count();
+        result.datagrams_per_second = result.seconds > 0.0 ? result.received / result.seconds : 0.0;
+        
+        engine.reset();
+        sender.reset();
+        close(rx);
+        close(tx);
+        return result;
+    }
+    
+    static void displayHeader() {
+        std::cout << std::left << std::setw(12) << "Engine"
+                 << std::setw(14) << "Sent"
+                 << std::setw(14) << "Received"
+                 << std::setw(14) << "Kernel Drops"
+                 << std::setw(12) << "Seconds"
+                 << "Datagrams/s\n";
+        std::cout << std::string(80, '-') << "\n";
+    }
+    
+    static void displayResult(const EngineResult& result) {
+        std::cout << std::left << std::setw(12) << result.engine
+                 << std::setw(14) << result.sent
+                 << std::setw(14) << result.received
+                 << std::setw(14) << result.kernel_drops
+                 << std::setw(12) << std::fixed << std::setprecision(3) << result.seconds
+                 << std::fixed << std::setprecision(0) << result.datagrams_per_second << "\n";
+    }
+};
+
+} // namespace EngineBenchmark
+
+void displayHelp(const char* program_name) {
+    std::cout << R"(
+🏁 Receive Engine Benchmark
+Usage: )" << program_name << R"( [OPTIONS]
+
+OPTIONS:
+   -p, --port PORT          Loopback port (default: 19876)
+   -n, --datagrams N        Datagrams per engine (default: 1000000)
+   -s, --size BYTES         Payload size (default: 420)
+   -b, --batch N            Receive batch size (default: 32)
+   -e, --engine NAME        Only run recvfrom, recvmmsg or io_uring
+   -h, --help               Show this help message
+)";
+}
+
+int main(int argc, char* argv[]) {
+    EngineBenchmark::BenchmarkOptions options;
+    std::vector<DatagramEngine::EngineKind> engines{
+        DatagramEngine::EngineKind::Recvfrom,
+        DatagramEngine::EngineKind::Recvmmsg,
+        DatagramEngine::EngineKind::IoUring
+    };
+    
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::runtime_error(arg + " requires a value");
+                }
+                return argv[++i];
+            };
+            
+            if (arg == "-h" || arg == "--help") {
+                displayHelp(argv[0]);
+                return 0;
+            } else if (arg == "-p" || arg == "--port") {
+                options.port = std::stoi(value());
+            } else if (arg == "-n" || arg == "--datagrams") {
+                options.datagrams = std::stoull(value());
+            } else if (arg == "-s" || arg == "--size") {
+                options.payload_bytes = std::stoul(value());
+            } else if (arg == "-b" || arg == "--batch") {
+                options.batch_size = std::stoul(value());
+            } else if (arg == "-e" || arg == "--engine") {
+                DatagramEngine::EngineKind kind;
+                if (!DatagramEngine::parseEngineKind(value(), kind)) {
+                    std::cerr << "❌ Error: --engine requires recvfrom, recvmmsg or io_uring\n";
+                    return 1;
+                }
+                engines = { kind };
+            } else {
+                std::cerr << "❌ Unknown option: " << arg << "\n";
+                return 1;
+            }
+        }
+        
+        if (options.payload_bytes < 2 || options.payload_bytes > 8192 || options.batch_size == 0) {
+            std::cerr << "❌ Error: size must be 2-8192 bytes and batch positive\n";
+            return 1;
+        }
+        
+        #ifdef _WIN32
+            WSADATA wsaData;
+            WSAStartup(MAKEWORD(2, 2), &wsaData);
+        #endif
+        
+        std::cout << "🏁 Receive engine benchmark: " << options.datagrams << " x "
+                 << options.payload_bytes << " byte datagrams over loopback\n\n";
+        
+        EngineBenchmark::ReceiveEngineBenchmark benchmark(options);
+        EngineBenchmark::ReceiveEngineBenchmark::displayHeader();
+        for (auto kind : engines) {
+            EngineBenchmark::ReceiveEngineBenchmark::displayResult(benchmark.run(kind));
+        }
+        
+        #ifdef _WIN32
+            WSACleanup();
+        #endif
+    
+    } catch (const std::exception& e) {
+        std::cerr << "🚨 Fatal Error: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
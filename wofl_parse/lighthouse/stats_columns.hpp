@@ -0,0 +1,165 @@
+#ifndef STATS_COLUMNS_HPP
+#define STATS_COLUMNS_HPP
+
+// 📐 Struct-of-arrays storage for per-lighthouse hot statistics
+// Each numeric field is its own contiguous column indexed by interned
+// lighthouse id, so fleet-wide summaries are straight-line reductions over
+// arrays (AVX2 when the host has it, scalar otherwise) instead of a walk
+// over fat per-lighthouse objects. Unused slots stay zero / Unknown, which
+// every reduction below treats as "contributes nothing".
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../cpu_dispatch.hpp"
+#include "beacon_status.hpp"
+
+namespace StatsColumns {
+
+// ⚡ Reductions: an AVX2 body (picked at runtime) and a scalar loop that also finishes the tail
+namespace detail {
+
+#ifdef CPU_DISPATCH_X86
+
+CPU_DISPATCH_TARGET_AVX2 inline double sumAvx2(const double* values, size_t count, size_t& i) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    for (; i + 8 <= count; i += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(values + i));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(values + i + 4));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+// Widened to 64-bit lanes so fleet-wide totals can't overflow
+CPU_DISPATCH_TARGET_AVX2 inline uint64_t sumAvx2(const uint32_t* values, size_t count, size_t& i) {
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= count; i += 4) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepu32_epi64(chunk));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline size_t countEqualAvx2(const uint8_t* values, size_t count, uint8_t target, size_t& i) {
+    size_t matches = 0;
+    __m256i needle = _mm256_set1_epi8(static_cast<char>(target));
+    for (; i + 32 <= count; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+        matches += static_cast<size_t>(std::popcount(mask));
+    }
+    return matches;
+}
+
+// Slots with 0 < value < cutoff; signed 64-bit compares, so cutoff must be positive
+CPU_DISPATCH_TARGET_AVX2 inline size_t countBeforeAvx2(const int64_t* values, size_t count, int64_t cutoff, size_t& i) {
+    size_t matches = 0;
+    __m256i limit = _mm256_set1_epi64x(cutoff);
+    __m256i zero = _mm256_setzero_si256();
+    for (; i + 4 <= count; i += 4) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        __m256i hit = _mm256_and_si256(_mm256_cmpgt_epi64(limit, chunk), _mm256_cmpgt_epi64(chunk, zero));
+        matches += static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(hit)))));
+    }
+    return matches;
+}
+
+#endif // CPU_DISPATCH_X86
+
+} // namespace detail
+
+inline double sum(const double* values, size_t count) {
+    size_t i = 0;
+    double total = 0.0;
+    
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) total = detail::sumAvx2(values, count, i);
+    #endif
+    
+    for (; i < count; ++i) total += values[i];
+    return total;
+}
+
+inline uint64_t sum(const uint32_t* values, size_t count) {
+    size_t i = 0;
+    uint64_t total = 0;
+    
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) total = detail::sumAvx2(values, count, i);
+    #endif
+    
+    for (; i < count; ++i) total += values[i];
+    return total;
+}
+
+inline size_t countEqual(const uint8_t* values, size_t count, uint8_t target) {
+    size_t i = 0;
+    size_t matches = 0;
+    
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) matches = detail::countEqualAvx2(values, count, target, i);
+    #endif
+    
+    for (; i < count; ++i) matches += values[i] == target;
+    return matches;
+}
+
+// Unused (zero) slots are never counted
+inline size_t countBefore(const int64_t* values, size_t count, int64_t cutoff) {
+    size_t i = 0;
+    size_t matches = 0;
+    
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) matches = detail::countBeforeAvx2(values, count, cutoff, i);
+    #endif
+    
+    for (; i < count; ++i) matches += values[i] > 0 && values[i] < cutoff;
+    return matches;
+}
+
+// 📊 Hot per-lighthouse columns
+struct LighthouseColumns {
+    std::vector<uint64_t> total_beacons{};
+    std::vector<uint32_t> missed_beacons{};
+    std::vector<uint8_t> status{};             // BeaconStatus::Health
+    std::vector<int64_t> last_seen_ns{};       // steady clock
+    std::vector<double> average_parse_us{};
+    std::vector<double> min_parse_us{};
+    std::vector<double> max_parse_us{};
+    
+    size_t size() const { return total_beacons.size(); }
+    
+    void ensure(size_t slots) {
+        if (slots <= size()) return;
+        total_beacons.resize(slots, 0);
+        missed_beacons.resize(slots, 0);
+        status.resize(slots, static_cast<uint8_t>(BeaconStatus::Health::Unknown));
+        last_seen_ns.resize(slots, 0);
+        average_parse_us.resize(slots, 0.0);
+        min_parse_us.resize(slots, 0.0);
+        max_parse_us.resize(slots, 0.0);
+    }
+    
+    size_t countStatus(BeaconStatus::Health health) const {
+        return countEqual(status.data(), status.size(), static_cast<uint8_t>(health));
+    }
+    
+    // Lighthouses whose last beacon arrived before cutoff_ns (steady clock)
+    size_t countSilentSince(int64_t cutoff_ns) const {
+        return countBefore(last_seen_ns.data(), last_seen_ns.size(), cutoff_ns);
+    }
+    
+    double sumAverageParse() const { return sum(average_parse_us.data(), average_parse_us.size()); }
+    uint64_t sumMissed() const { return sum(missed_beacons.data(), missed_beacons.size()); }
+};
+
+} // namespace StatsColumns
+
+#endif // STATS_COLUMNS_HPP
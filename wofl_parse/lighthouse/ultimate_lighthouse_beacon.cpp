@@ -8,6 +8,8 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <span>
+#include <string_view>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -29,6 +31,14 @@
     #include <curl/curl.h>
 #endif
 
+#include "latency_trace.hpp"
+#include "../listener_socket.hpp"
+#include "../async_logger.hpp"
+#include "beacon_status.hpp"
+#include "../cpu_dispatch.hpp"
+#include "../parse_outcome.hpp"
+#include "datagram_engine.hpp"
+
 // 🏰 ULTIMATE LIGHTHOUSE BEACON SYSTEM 🏰
 // Powered by RTC's Jsonifier - The Absolute Pinnacle of JSON Performance
 // Featuring:
@@ -55,6 +65,12 @@ struct FastPingResponse {
     std::chrono::high_resolution_clock::time_point response_time{};
     std::chrono::microseconds parse_duration{ 0 };
     bool parse_success{ false };
+    BeaconStatus::PingStatus ping{ BeaconStatus::PingStatus::Unknown };    // decoded from status
+    
+    // ⏱️ Trace stamps (ns since Unix epoch) forwarded in the next beacon
+    uint64_t fetch_start_ns{ 0 };
+    uint64_t fetch_end_ns{ 0 };
+    uint64_t parse_end_ns{ 0 };
 };
 
 // 🔥 Ultimate Beacon Payload with Performance Metrics
@@ -79,12 +95,119 @@ struct UltimateBeaconPayload {
     double system_uptime_hours{ 0.0 };
     uint32_t beacon_sequence_number{ 0 };
     jsonifier::string lighthouse_version{ "ULTIMATE-v3.0-RTC-POWERED" };
+    
+    // ⏱️ Latency trace (ns since Unix epoch, 0 = stage not traced)
+    uint64_t trace_fetch_start_ns{ 0 };
+    uint64_t trace_fetch_end_ns{ 0 };
+    uint64_t trace_parse_end_ns{ 0 };
+    uint64_t trace_send_ns{ 0 };
+};
+
+// 📋 Wire fields, for classifying payloads the parser rejects
+inline constexpr std::array<ParseResult::FieldSpec, 7> fastping_response_schema{ {
+    { "status", ParseResult::JsonType::String, true },
+    { "connecting_ip", ParseResult::JsonType::String },
+    { "anonymity_level", ParseResult::JsonType::String },
+    { "speed_hint", ParseResult::JsonType::String },
+    { "server_processing_latency_ms", ParseResult::JsonType::Number },
+    { "client_ip_from_headers", ParseResult::JsonType::String },
+    { "message", ParseResult::JsonType::String },
+} };
+
+inline constexpr std::array<ParseResult::FieldSpec, 20> beacon_payload_schema{ {
+    { "beacon_id", ParseResult::JsonType::String, true },
+    { "timestamp", ParseResult::JsonType::Number },
+    { "status", ParseResult::JsonType::String },
+    { "last_ping_status", ParseResult::JsonType::String },
+    { "ping_latency_ms", ParseResult::JsonType::Number },
+    { "signal_age_seconds", ParseResult::JsonType::Number },
+    { "json_parse_time_microseconds", ParseResult::JsonType::Number },
+    { "json_serialize_time_microseconds", ParseResult::JsonType::Number },
+    { "total_requests_processed", ParseResult::JsonType::Number },
+    { "successful_parses", ParseResult::JsonType::Number },
+    { "failed_parses", ParseResult::JsonType::Number },
+    { "average_throughput_mbps", ParseResult::JsonType::Number },
+    { "cpu_optimization_level", ParseResult::JsonType::String },
+    { "system_uptime_hours", ParseResult::JsonType::Number },
+    { "beacon_sequence_number", ParseResult::JsonType::Number },
+    { "lighthouse_version", ParseResult::JsonType::String },
+    { "trace_fetch_start_ns", ParseResult::JsonType::Number },
+    { "trace_fetch_end_ns", ParseResult::JsonType::Number },
+    { "trace_parse_end_ns", ParseResult::JsonType::Number },
+    { "trace_send_ns", ParseResult::JsonType::Number },
+} };
+
+// 🧵 One jsonifier core per thread that uses a processor
+// A jsonifier_core keeps internal parse/serialize buffers, so two threads must
+// never share one. Each thread gets its own core the first time it touches the
+// pool; after that the lookup is a thread_local compare, with no lock, and the
+// core's buffers stay warm across calls. Cores live as long as the pool.
+class JsonCorePool {
+private:
+    using Core = jsonifier::jsonifier_core<>;
+    
+    struct Slot {
+        std::thread::id owner{};
+        std::unique_ptr<Core> core{};
+    };
+    
+    // Process-unique, so a new pool at a freed pool's address never hits a stale cache
+    static inline std::atomic<uint64_t> next_pool_id{ 1 };
+    const uint64_t pool_id{ next_pool_id.fetch_add(1) };
+    
+    mutable std::mutex slots_mutex{};
+    std::vector<Slot> slots{};
+    
+    struct ThreadCache {
+        uint64_t pool_id{ 0 };
+        Core* core{ nullptr };
+    };
+    
+    Core& acquireSlow(ThreadCache& cache) {
+        std::lock_guard<std::mutex> lock(slots_mutex);
+        auto self = std::this_thread::get_id();
+        
+        Core* core = nullptr;
+        for (auto& slot : slots) {
+            if (slot.owner == self) {
+                core = slot.core.get();
+                break;
+            }
+        }
+        if (!core) {
+            slots.push_back({ self, std::make_unique<Core>() });
+            core = slots.back().core.get();
+        }
+        
+        cache.pool_id = pool_id;
+        cache.core = core;
+        return *core;
+    }
+    
+public:
+    JsonCorePool() = default;
+    JsonCorePool(const JsonCorePool&) = delete;
+    JsonCorePool& operator=(const JsonCorePool&) = delete;
+    
+    // The calling thread's core; only that thread may use the reference
+    Core& local() {
+        // One cached pool per thread covers the normal one-processor-per-program case
+        thread_local ThreadCache cache{};
+        if (cache.pool_id == pool_id) return *cache.core;
+        return acquireSlow(cache);
+    }
+    
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(slots_mutex);
+        return slots.size();
+    }
 };
 
 // ⚡ Ultra-High Performance JSON Processor
+// Safe to share between threads: each caller parses and serializes on its own pooled core.
 class UltimateJsonProcessor {
 private:
-    jsonifier::jsonifier_core<> core{};
+    JsonCorePool cores{};
     mutable std::mutex performance_mutex{};
     
     // Performance tracking
@@ -92,6 +215,7 @@ private:
     std::atomic<uint64_t> successful_parses{ 0 };
     std::atomic<uint64_t> total_bytes_processed{ 0 };
     std::atomic<double> total_parse_time_microseconds{ 0.0 };
+    ParseResult::ParseErrorCounters parse_errors{};
     
 public:
     UltimateJsonProcessor() {
@@ -101,40 +225,47 @@ public:
     }
     
     // 🔥 Ultra-fast parsing with comprehensive metrics
+    // Never throws: a rejected payload is counted by kind and returned as a failed
+    // outcome. schema (the expected fields) lets a failure be pinned on a key.
     template<typename T>
-    bool parseWithMetrics(T& object, const std::string& json_data) {
+    ParseResult::ParseOutcome parseWithMetrics(T& object, std::string_view json_data,
+                                               std::span<const ParseResult::FieldSpec> schema = {}) {
         auto start = std::chrono::high_resolution_clock::now();
+        bool parsed = cores.local().parseJson(object, json_data);
+        auto end = std::chrono::high_resolution_clock::now();
         
-        try {
-            auto result = core.parseJson(object, json_data);
-            auto end = std::chrono::high_resolution_clock::now();
-            
-            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
-            double microseconds = duration.count() / 1000.0;
-            
-            // Update performance metrics
-            total_parses.fetch_add(1);
-            successful_parses.fetch_add(1);
-            total_bytes_processed.fetch_add(json_data.size());
-            
-            // Atomic update of total parse time
-            double expected = total_parse_time_microseconds.load();
-            while (!total_parse_time_microseconds.compare_exchange_weak(expected, expected + microseconds));
-            
-            // Store parse time in the response object if it has the field
-            if constexpr (requires { object.parse_duration; }) {
-                object.parse_duration = std::chrono::microseconds(static_cast<uint64_t>(microseconds));
-            }
-            if constexpr (requires { object.parse_success; }) {
-                object.parse_success = true;
+        total_parses.fetch_add(1);
+        if constexpr (requires { object.parse_success; }) {
+            object.parse_success = parsed;
+        }
+        
+        if (!parsed) {
+            // Cold path: work out why, then count it
+            ParseResult::ParseOutcome outcome = ParseResult::diagnose(json_data, schema);
+            if (outcome.ok()) {
+                outcome = ParseResult::ParseOutcome::failure(ParseResult::ParseErrorKind::Rejected, 0);
             }
-            
-            return true;
-        } catch (const std::exception& e) {
-            total_parses.fetch_add(1);
-            std::cerr << "🚨 Parse Error: " << e.what() << std::endl;
-            return false;
+            parse_errors.record(outcome.kind);
+            return outcome;
         }
+        
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double microseconds = duration.count() / 1000.0;
+        
+        // Update performance metrics
+        successful_parses.fetch_add(1);
+        total_bytes_processed.fetch_add(json_data.size());
+        
+        // Atomic update of total parse time
+        double expected = total_parse_time_microseconds.load();
+        while (!total_parse_time_microseconds.compare_exchange_weak(expected, expected + microseconds));
+        
+        // Store parse time in the response object if it has the field
+        if constexpr (requires { object.parse_duration; }) {
+            object.parse_duration = std::chrono::microseconds(static_cast<uint64_t>(microseconds));
+        }
+        
+        return ParseResult::ParseOutcome::success();
     }
     
     // 🚀 Ultra-fast serialization
@@ -144,7 +275,7 @@ public:
         
         try {
             std::string result;
-            core.serializeJson(object, result);
+            cores.local().serializeJson(object, result);
             
             auto end = std::chrono::high_resolution_clock::now();
             auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
@@ -166,6 +297,12 @@ public:
         double success_rate;
     };
     
+    // Number of threads that have parsed or serialized so far
+    size_t coreCount() const { return cores.size(); }
+    
+    // e.g. "truncated 3, unknown key 1"
+    std::string failureSummary() const { return parse_errors.summary(); }
+    
     PerformanceMetrics getMetrics() const {
         std::lock_guard<std::mutex> lock(performance_mutex);
         
@@ -192,18 +329,21 @@ public:
     }
     
 private:
+    // Runtime kernels first (what this host is actually running), then Jsonifier's compiled level
     std::string getOptimizationLevel() const {
+        std::string level = "Runtime " + CpuDispatch::describeSelection() + " | Jsonifier build ";
         #if JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX512)
-            return "AVX-512 + AVX2 + BMI2 (MAXIMUM POWER!)";
+            level += "AVX-512";
         #elif JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX2)
-            return "AVX2 + BMI2 (HIGH PERFORMANCE)";
+            level += "AVX2";
         #elif JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX)
-            return "AVX + SIMD (ACCELERATED)";
+            level += "AVX";
         #elif JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_NEON)
-            return "ARM NEON SIMD (ARM OPTIMIZED)";
+            level += "NEON";
         #else
-            return "Fallback Mode (Still Fast!)";
+            level += "baseline";
         #endif
+        return level;
     }
     
     std::string getCPUFeatures() const {
@@ -434,16 +574,25 @@ private:
             
             try {
                 // 🚀 Perform ultra-fast HTTP request
+                uint64_t fetch_start_ns = LatencyTrace::wallClockNanos();
                 auto [success, response_data] = http_client->performRequest(fastping_url);
+                uint64_t fetch_end_ns = LatencyTrace::wallClockNanos();
                 
                 if (success && !response_data.empty()) {
                     // 🔥 Ultra-fast JSON parsing with RTC Jsonifier
                     FastPingResponse response;
                     response.response_time = std::chrono::high_resolution_clock::now();
                     
-                    bool parse_success = json_processor->parseWithMetrics(response, response_data);
+                    auto outcome = json_processor->parseWithMetrics(response, response_data, fastping_response_schema);
+                    response.fetch_start_ns = fetch_start_ns;
+                    response.fetch_end_ns = fetch_end_ns;
+                    response.parse_end_ns = LatencyTrace::wallClockNanos();
                     
-                    if (parse_success) {
+                    if (!outcome.ok()) {
+                        std::cout << "🚨 FastPing response rejected: " << ParseResult::errorKindName(outcome.kind)
+                                 << " at byte " << outcome.offset << "\n";
+                    } else {
+                        response.ping = BeaconStatus::decodePing({ response.status.data(), response.status.size() });
                         std::lock_guard<std::mutex> lock(response_mutex);
                         last_response = std::move(response);
                         total_requests.fetch_add(1);
@@ -485,22 +634,27 @@ private:
         target_addr.sin_port = htons(beacon_port);
         inet_pton(AF_INET, beacon_ip.c_str(), &target_addr.sin_addr);
         
+        // One beacon per interval, so the plain sendto engine: there is nothing to batch
+        auto sender = DatagramEngine::createSendEngine(DatagramEngine::EngineKind::Recvfrom, sock);
+        
         while (running.load()) {
             try {
                 // Create ultra-fast beacon payload
                 UltimateBeaconPayload payload = createBeaconPayload();
                 
+                // Stamped last so serialize + sendto land in the network stage
+                payload.trace_send_ns = LatencyTrace::wallClockNanos();
+                
                 // 🚀 Ultra-fast serialization with RTC Jsonifier
                 std::string json_payload = json_processor->serializeWithMetrics(payload);
                 
                 // Send UDP beacon
-                ssize_t sent = sendto(sock, json_payload.c_str(), json_payload.length(), 0,
-                                    reinterpret_cast<sockaddr*>(&target_addr), sizeof(target_addr));
+                sender->queue(json_payload.data(), json_payload.length(), target_addr);
                 
-                if (sent > 0) {
+                if (sender->flush() > 0) {
                     beacon_sequence.fetch_add(1);
                     // Uncomment for beacon confirmation:
-                    // std::cout << "📡 Beacon #" << beacon_sequence.load() << " transmitted (" << sent << " bytes)\n";
+                    // std::cout << "📡 Beacon #" << beacon_sequence.load() << " transmitted (" << json_payload.length() << " bytes)\n";
                 }
             } catch (const std::exception& e) {
                 std::cout << "🚨 Beacon error: " << e.what() << "\n";
@@ -536,16 +690,19 @@ private:
             
             payload.signal_age_seconds = static_cast<uint32_t>(age.count());
             payload.last_ping_status = last_response.status;
+            payload.trace_fetch_start_ns = last_response.fetch_start_ns;
+            payload.trace_fetch_end_ns = last_response.fetch_end_ns;
+            payload.trace_parse_end_ns = last_response.parse_end_ns;
             payload.ping_latency_ms = last_response.server_processing_latency_ms;
             
             // Determine overall health status
-            if (age.count() < 60 && last_response.status == "ok") {
-                payload.status = "healthy";
+            auto health = BeaconStatus::Health::Critical;
+            if (age.count() < 60 && last_response.ping == BeaconStatus::PingStatus::Ok) {
+                health = BeaconStatus::Health::Healthy;
             } else if (age.count() < 120) {
-                payload.status = "warning";
-            } else {
-                payload.status = "critical";
+                health = BeaconStatus::Health::Warning;
             }
+            payload.status = BeaconStatus::healthName(health);
         }
         
         // Add performance metrics
@@ -556,15 +713,8 @@ private:
         payload.failed_parses = metrics.total_parses - metrics.successful_parses;
         payload.average_throughput_mbps = metrics.throughput_mbps;
         
-        #if JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX512)
-            payload.cpu_optimization_level = "AVX-512";
-        #elif JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX2)
-            payload.cpu_optimization_level = "AVX2";
-        #elif JSONIFIER_CHECK_FOR_AVX(JSONIFIER_AVX)
-            payload.cpu_optimization_level = "AVX";
-        #else
-            payload.cpu_optimization_level = "Standard";
-        #endif
+        // The ISA the runtime-dispatched kernels picked on this host, not the build machine's
+        payload.cpu_optimization_level = CpuDispatch::isaName(CpuDispatch::activeIsa());
         
         auto uptime = std::chrono::duration_cast<std::chrono::hours>(
             std::chrono::high_resolution_clock::now() - start_time);
@@ -610,6 +760,8 @@ private:
         std::cout << "   JSON Throughput: " << std::fixed << std::setprecision(1) 
                  << metrics.throughput_mbps << " MB/s\n";
         std::cout << "   Beacons Transmitted: " << beacon_sequence.load() << "\n";
+        std::cout << "   Jsonifier Cores: " << json_processor->coreCount() << " (one per thread)\n";
+        std::cout << "   Parse Failures: " << json_processor->failureSummary() << "\n";
         
         auto uptime = std::chrono::duration_cast<std::chrono::minutes>(
             std::chrono::high_resolution_clock::now() - start_time);
@@ -625,6 +777,7 @@ private:
         #else
             std::cout << "STANDARD\n";
         #endif
+        std::cout << "🧬 Runtime SIMD kernels: " << CpuDispatch::describeSelection() << "\n";
         
         std::cout << "🏰 ═══════════════════════════════════════════════════════════════════ 🏰\n";
     }
@@ -640,6 +793,7 @@ private:
         std::cout << "   Total JSON Parses: " << metrics.total_parses << "\n";
         std::cout << "   Success Rate: " << std::fixed << std::setprecision(1) 
                  << metrics.success_rate << "%\n";
+        std::cout << "   Parse Failures: " << json_processor->failureSummary() << "\n";
         std::cout << "   Average Parse Time: " << std::fixed << std::setprecision(2) 
                  << metrics.average_parse_time_us << " microseconds\n";
         std::cout << "   Total Throughput: " << std::fixed << std::setprecision(1) 
@@ -696,17 +850,21 @@ public:
             return;
         }
         
+        auto tuning = ListenerSocket::configureListenerSocket(sock);
+        
         std::cout << "🎯 Ultimate Beacon Listener bound to port " << listen_port << "\n";
+        ListenerSocket::displaySocketTuning(tuning);
         std::cout << "🎧 Listening for lighthouse beacons...\n";
         std::cout << "Press Ctrl+C to stop\n\n";
         
         char buffer[4096];
         sockaddr_in client_addr{};
-        socklen_t client_len = sizeof(client_addr);
+        ListenerSocket::ReceiveMetadata meta;
+        ListenerSocket::KernelDropCounter kernel_drops;
         
         while (running.load()) {
-            ssize_t received = recvfrom(sock, buffer, sizeof(buffer) - 1, 0,
-                                      reinterpret_cast<sockaddr*>(&client_addr), &client_len);
+            long received = ListenerSocket::receiveWithMetadata(sock, buffer, sizeof(buffer) - 1,
+                                                                &client_addr, meta);
             
             if (received > 0) {
                 buffer[received] = '\0';
@@ -714,27 +872,30 @@ public:
                 char client_ip[INET_ADDRSTRLEN];
                 inet_ntop(AF_INET, &client_addr.sin_addr, client_ip, INET_ADDRSTRLEN);
                 
-                auto now = std::chrono::system_clock::now();
-                auto time_t = std::chrono::system_clock::to_time_t(now);
-                auto tm = *std::localtime(&time_t);
+                if (uint32_t dropped = kernel_drops.observe(meta)) {
+                    AsyncLog::Record() << "📉 Kernel dropped " << dropped << " beacon(s) - socket queue overflowed (total "
+                                       << kernel_drops.total() << ")\n";
+                }
                 
-                std::cout << "📡 [" << std::put_time(&tm, "%H:%M:%S") << "] ";
-                std::cout << "Received " << received << " bytes from " << client_ip << "\n";
+                AsyncLog::Record() << "📡 [" << AsyncLog::clockText() << "] "
+                                   << "Received " << received << " bytes from " << client_ip << "\n";
                 
                 // Parse the beacon payload with ultra-fast RTC Jsonifier
                 UltimateBeaconPayload payload;
                 auto start = std::chrono::high_resolution_clock::now();
-                bool success = json_processor->parseWithMetrics(payload, std::string(buffer, received));
+                std::string_view data(buffer, static_cast<size_t>(received));
+                auto outcome = json_processor->parseWithMetrics(payload, data, beacon_payload_schema);
                 auto end = std::chrono::high_resolution_clock::now();
                 
                 auto parse_time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
                 double parse_microseconds = parse_time.count() / 1000.0;
                 
-                if (success) {
+                if (outcome.ok()) {
                     displayBeaconInfo(payload, parse_microseconds);
                 } else {
-                    std::cout << "🚨 Failed to parse beacon payload\n";
-                    std::cout << "Raw data: " << std::string(buffer, received) << "\n\n";
+                    AsyncLog::Record() << "🚨 Failed to parse beacon payload: " << ParseResult::errorKindName(outcome.kind)
+                                       << " at byte " << outcome.offset << "\n"
+                                       << "Raw data: " << data << "\n\n";
                 }
             }
         }
@@ -748,46 +909,44 @@ public:
     
 private:
     void displayBeaconInfo(const UltimateBeaconPayload& payload, double parse_time_us) {
-        std::cout << "\n┌─────────────────────────────────────────┐\n";
-        std::cout << "│ 🚨 ULTIMATE LIGHTHOUSE BEACON RECEIVED │\n";
-        std::cout << "├─────────────────────────────────────────┤\n";
-        std::cout << "│ ID: " << std::left << std::setw(31) << payload.beacon_id << " │\n";
-        std::cout << "│ Status: " << std::left << std::setw(27) << payload.status << " │\n";
-        std::cout << "│ Ping Status: " << std::left << std::setw(23) << payload.last_ping_status << " │\n";
-        std::cout << "│ Ping Latency: " << std::left << std::setw(22) << (std::to_string(payload.ping_latency_ms) + "ms") << " │\n";
-        std::cout << "│ Signal Age: " << std::left << std::setw(24) << (std::to_string(payload.signal_age_seconds) + "s") << " │\n";
-        
-        auto time_t = static_cast<std::time_t>(payload.timestamp);
-        auto tm = *std::localtime(&time_t);
-        std::ostringstream timestamp_str;
-        timestamp_str << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-        std::cout << "│ Timestamp: " << std::left << std::setw(25) << timestamp_str.str() << " │\n";
-        std::cout << "└─────────────────────────────────────────┘\n";
+        AsyncLog::Record log;
+        
+        log << "\n┌─────────────────────────────────────────┐\n";
+        log << "│ 🚨 ULTIMATE LIGHTHOUSE BEACON RECEIVED │\n";
+        log << "├─────────────────────────────────────────┤\n";
+        log << "│ ID: " << std::left << std::setw(31) << payload.beacon_id << " │\n";
+        log << "│ Status: " << std::left << std::setw(27) << payload.status << " │\n";
+        log << "│ Ping Status: " << std::left << std::setw(23) << payload.last_ping_status << " │\n";
+        log << "│ Ping Latency: " << std::left << std::setw(22) << (std::to_string(payload.ping_latency_ms) + "ms") << " │\n";
+        log << "│ Signal Age: " << std::left << std::setw(24) << (std::to_string(payload.signal_age_seconds) + "s") << " │\n";
+        log << "│ Timestamp: " << std::left << std::setw(25) << AsyncLog::formatDateTime(static_cast<std::time_t>(payload.timestamp)) << " │\n";
+        log << "└─────────────────────────────────────────┘\n";
         
         // Health status indicator
-        std::string health_status = "✅ HEALTHY";
-        if (payload.status == "warning") health_status = "⚠️  WARNING";
-        if (payload.status == "critical") health_status = "❌ CRITICAL";
+        auto health = BeaconStatus::decodeHealth({ payload.status.data(), payload.status.size() });
+        const char* health_status = "✅ HEALTHY";
+        if (health == BeaconStatus::Health::Warning) health_status = "⚠️  WARNING";
+        if (health == BeaconStatus::Health::Critical) health_status = "❌ CRITICAL";
         
-        std::cout << health_status << "\n";
-        std::cout << "   Parse time: " << std::fixed << std::setprecision(2) << parse_time_us << "µs | ";
-        std::cout << "Validation: ✅\n";
+        log << health_status << "\n";
+        log << "   Parse time: " << std::fixed << std::setprecision(2) << parse_time_us << "µs | ";
+        log << "Validation: ✅\n";
         
         // 🚀 Performance metrics display
         if (payload.total_requests_processed > 0) {
-            std::cout << "\n🚀 LIGHTHOUSE PERFORMANCE METRICS:\n";
-            std::cout << "   CPU Optimization: " << payload.cpu_optimization_level << "\n";
-            std::cout << "   Total Requests: " << payload.total_requests_processed << "\n";
-            std::cout << "   JSON Parse Time: " << std::fixed << std::setprecision(2) 
-                     << payload.json_parse_time_microseconds << "µs\n";
-            std::cout << "   JSON Throughput: " << std::fixed << std::setprecision(1) 
-                     << payload.average_throughput_mbps << " MB/s\n";
-            std::cout << "   System Uptime: " << std::fixed << std::setprecision(1) 
-                     << payload.system_uptime_hours << " hours\n";
-            std::cout << "   Beacon #" << payload.beacon_sequence_number << "\n";
+            log << "\n🚀 LIGHTHOUSE PERFORMANCE METRICS:\n";
+            log << "   CPU Optimization: " << payload.cpu_optimization_level << "\n";
+            log << "   Total Requests: " << payload.total_requests_processed << "\n";
+            log << "   JSON Parse Time: " << std::fixed << std::setprecision(2) 
+                << payload.json_parse_time_microseconds << "µs\n";
+            log << "   JSON Throughput: " << std::fixed << std::setprecision(1) 
+                << payload.average_throughput_mbps << " MB/s\n";
+            log << "   System Uptime: " << std::fixed << std::setprecision(1) 
+                << payload.system_uptime_hours << " hours\n";
+            log << "   Beacon #" << payload.beacon_sequence_number << "\n";
         }
         
-        std::cout << "\n";
+        log << "\n";
     }
 };
 
@@ -20,36 +20,23 @@
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <cstring>
+#include <cstdio>
 #include <iomanip>
 #include <sstream>
 #include <vector>
 #include <map>
 #include <algorithm>
 
-// ==== BEACON DATA STRUCTURES ====
-struct BeaconData {
-    std::string beacon_id;
-    uint64_t timestamp{0};
-    std::string status;
-    std::string last_ping_status;
-    double ping_latency{0.0};
-    uint64_t signal_age_seconds{0};
-    double parse_throughput_mbps{0.0};
-    std::string cpu_optimizations;
-    
-    // Reception metadata
-    std::chrono::system_clock::time_point received_time;
-    std::string sender_ip;
-    int sender_port{0};
-    size_t payload_size{0};
-    std::chrono::microseconds parse_time{0};
-    bool valid{false};
-};
+#include "ultrafast_beacon_parser.hpp"
+#include "../listener_socket.hpp"
+#include "../async_logger.hpp"
 
+// ==== LISTENER STATISTICS ====
 struct ListenerStats {
     std::atomic<uint64_t> total_beacons{0};
     std::atomic<uint64_t> valid_beacons{0};
     std::atomic<uint64_t> total_bytes{0};
+    ListenerSocket::KernelDropCounter kernel_drops;
     std::atomic<double> average_parse_time{0.0};
     std::atomic<double> average_throughput{0.0};
     std::chrono::system_clock::time_point start_time;
@@ -59,125 +46,13 @@ struct ListenerStats {
     }
 };
 
-// ==== ULTRA-FAST JSON PROCESSOR ====
-class UltraFastBeaconParser {
-private:
-    std::atomic<uint64_t> total_parses{0};
-    std::atomic<double> average_parse_time{0.0};
-
-public:
-    bool parseBeaconPayload(const std::string& json, BeaconData& beacon) {
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        beacon.valid = false;
-        beacon.payload_size = json.size();
-        
-        // Ultra-optimized field extraction using RTC-inspired techniques
-        if (!extractStringField(json, "beacon_id", beacon.beacon_id)) return false;
-        if (!extractStringField(json, "status", beacon.status)) return false;
-        
-        extractStringField(json, "last_ping_status", beacon.last_ping_status);
-        extractStringField(json, "cpu_optimizations", beacon.cpu_optimizations);
-        
-        // Extract numeric fields
-        extractUint64Field(json, "timestamp", beacon.timestamp);
-        extractDoubleField(json, "ping_latency", beacon.ping_latency);
-        extractUint64Field(json, "signal_age_seconds", beacon.signal_age_seconds);
-        extractDoubleField(json, "parse_throughput_mbps", beacon.parse_throughput_mbps);
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        beacon.parse_time = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-        
-        updatePerformanceMetrics(beacon.parse_time);
-        
-        beacon.valid = true;
-        return true;
-    }
-    
-    double getAverageParseTime() const {
-        return average_parse_time.load();
-    }
-    
-    uint64_t getTotalParses() const {
-        return total_parses.load();
-    }
-
-private:
-    bool extractStringField(const std::string& json, const std::string& key, std::string& value) {
-        std::string search_key = "\"" + key + "\":\"";
-        size_t start = json.find(search_key);
-        if (start == std::string::npos) return false;
-        
-        start += search_key.length();
-        size_t end = json.find("\"", start);
-        if (end == std::string::npos) return false;
-        
-        value = json.substr(start, end - start);
-        return true;
-    }
-    
-    bool extractDoubleField(const std::string& json, const std::string& key, double& value) {
-        std::string search_key = "\"" + key + "\":";
-        size_t start = json.find(search_key);
-        if (start == std::string::npos) return false;
-        
-        start += search_key.length();
-        size_t end = start;
-        while (end < json.length() && (std::isdigit(json[end]) || json[end] == '.' || json[end] == '-')) {
-            end++;
-        }
-        
-        if (end > start) {
-            try {
-                value = std::stod(json.substr(start, end - start));
-                return true;
-            } catch (...) {
-                return false;
-            }
-        }
-        return false;
-    }
-    
-    bool extractUint64Field(const std::string& json, const std::string& key, uint64_t& value) {
-        std::string search_key = "\"" + key + "\":";
-        size_t start = json.find(search_key);
-        if (start == std::string::npos) return false;
-        
-        start += search_key.length();
-        size_t end = start;
-        while (end < json.length() && std::isdigit(json[end])) {
-            end++;
-        }
-        
-        if (end > start) {
-            try {
-                value = std::stoull(json.substr(start, end - start));
-                return true;
-            } catch (...) {
-                return false;
-            }
-        }
-        return false;
-    }
-    
-    void updatePerformanceMetrics(std::chrono::microseconds parse_time) {
-        total_parses++;
-        
-        // Exponential moving average for parse time
-        double alpha = 0.1;
-        double current_avg = average_parse_time.load();
-        double new_time = parse_time.count();
-        average_parse_time.store(current_avg * (1.0 - alpha) + new_time * alpha);
-    }
-};
-
 // ==== BEACON HEALTH ANALYZER ====
 class BeaconHealthAnalyzer {
 public:
     struct HealthAssessment {
-        std::string overall_status;
-        std::string health_icon;
-        std::string concerns;
+        BeaconStatus::Health overall_status{BeaconStatus::Health::Unknown};
+        const char* health_icon{""};
+        const char* concerns{""};
         double confidence_score{0.0};
     };
     
@@ -185,26 +60,29 @@ public:
         HealthAssessment assessment;
         
         auto now = std::chrono::system_clock::now();
-        auto beacon_time = std::chrono::system_clock::from_time_t(beacon.timestamp);
+        auto beacon_time = beacon.trace_send_ns
+            ? std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                  std::chrono::nanoseconds(beacon.trace_send_ns)))
+            : std::chrono::system_clock::from_time_t(beacon.timestamp);
         auto time_diff = std::chrono::duration_cast<std::chrono::seconds>(now - beacon_time);
         
         // Analyze overall health
-        if (beacon.status == "healthy" && 
-            beacon.last_ping_status == "ok" && 
+        if (beacon.health == BeaconStatus::Health::Healthy && 
+            beacon.ping == BeaconStatus::PingStatus::Ok && 
             beacon.signal_age_seconds < 30 &&
             time_diff.count() < 60) {
-            assessment.overall_status = "HEALTHY";
+            assessment.overall_status = BeaconStatus::Health::Healthy;
             assessment.health_icon = "✅";
             assessment.confidence_score = 0.95;
-        } else if (beacon.status == "warning" || 
+        } else if (beacon.health == BeaconStatus::Health::Warning || 
                    beacon.signal_age_seconds < 120 ||
                    time_diff.count() < 300) {
-            assessment.overall_status = "WARNING";
+            assessment.overall_status = BeaconStatus::Health::Warning;
             assessment.health_icon = "⚠️";
             assessment.confidence_score = 0.75;
             assessment.concerns = "Signal aging or degraded performance";
         } else {
-            assessment.overall_status = "CRITICAL";
+            assessment.overall_status = BeaconStatus::Health::Critical;
             assessment.health_icon = "❌";
             assessment.confidence_score = 0.50;
             assessment.concerns = "No recent updates or failed ping status";
@@ -229,56 +107,50 @@ private:
     std::vector<BeaconData> recent_beacons;
     const size_t max_recent_beacons{10};
     
-    void print_timestamp() {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        std::cout << "[" << std::put_time(std::localtime(&time_t), "%H:%M:%S") << "] ";
-    }
-    
+    // One async record per beacon: formatting stays on this thread, the write happens on the flusher
     void display_beacon_detailed(const BeaconData& beacon, int beacon_number) {
         auto health = health_analyzer.analyzeBeacon(beacon);
         
-        print_timestamp();
-        std::cout << "📡 Beacon #" << beacon_number << " from " 
-                 << beacon.sender_ip << ":" << beacon.sender_port << "\n";
-        
-        std::cout << "┌─────────────────────────────────────────┐\n";
-        std::cout << "│ " << health.health_icon << " LIGHTHOUSE BEACON RECEIVED          │\n";
-        std::cout << "├─────────────────────────────────────────┤\n";
-        std::cout << "│ ID: " << std::left << std::setw(35) << beacon.beacon_id << "│\n";
-        std::cout << "│ Status: " << std::left << std::setw(31) << beacon.status << "│\n";
-        std::cout << "│ Ping Status: " << std::left << std::setw(27) << beacon.last_ping_status << "│\n";
-        
-        std::ostringstream latency_str;
-        latency_str << std::fixed << std::setprecision(2) << beacon.ping_latency << "ms";
-        std::cout << "│ Ping Latency: " << std::left << std::setw(26) << latency_str.str() << "│\n";
-        std::cout << "│ Signal Age: " << std::left << std::setw(28) << (std::to_string(beacon.signal_age_seconds) + "s") << "│\n";
-        
-        auto time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::from_time_t(beacon.timestamp));
-        std::ostringstream time_str;
-        time_str << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-        std::cout << "│ Timestamp: " << std::left << std::setw(27) << time_str.str() << "│\n";
-        
-        std::ostringstream throughput_str;
-        throughput_str << std::fixed << std::setprecision(1) << beacon.parse_throughput_mbps << " MB/s";
-        std::cout << "│ Throughput: " << std::left << std::setw(27) << throughput_str.str() << "│\n";
-        std::cout << "│ CPU Opts: " << std::left << std::setw(29) << beacon.cpu_optimizations << "│\n";
-        std::cout << "└─────────────────────────────────────────┘\n";
-        
-        std::cout << health.health_icon << " Beacon status: " << health.overall_status << "\n";
-        std::cout << "   Parse time: " << beacon.parse_time.count() << "µs | Validation: ✅\n";
-        
-        if (!health.concerns.empty()) {
-            std::cout << "   ⚠️  Concerns: " << health.concerns << "\n";
+        AsyncLog::Record log;
+        log.timestamp() << "📡 Beacon #" << beacon_number << " from " 
+                        << beacon.sender_ip << ":" << beacon.sender_port << "\n";
+        
+        log << "┌─────────────────────────────────────────┐\n";
+        log << "│ " << health.health_icon << " LIGHTHOUSE BEACON RECEIVED          │\n";
+        log << "├─────────────────────────────────────────┤\n";
+        log << "│ ID: " << std::left << std::setw(35) << beacon.beacon_id << "│\n";
+        log << "│ Status: " << std::left << std::setw(31) << beacon.status << "│\n";
+        log << "│ Ping Status: " << std::left << std::setw(27) << beacon.last_ping_status << "│\n";
+        
+        char latency_str[32];
+        std::snprintf(latency_str, sizeof(latency_str), "%.2fms", beacon.ping_latency);
+        log << "│ Ping Latency: " << std::left << std::setw(26) << latency_str << "│\n";
+        log << "│ Signal Age: " << std::left << std::setw(28) << (std::to_string(beacon.signal_age_seconds) + "s") << "│\n";
+        log << "│ Timestamp: " << std::left << std::setw(27) << AsyncLog::formatDateTime(static_cast<std::time_t>(beacon.timestamp)) << "│\n";
+        
+        char throughput_str[32];
+        std::snprintf(throughput_str, sizeof(throughput_str), "%.1f MB/s", beacon.parse_throughput_mbps);
+        log << "│ Throughput: " << std::left << std::setw(27) << throughput_str << "│\n";
+        log << "│ CPU Opts: " << std::left << std::setw(29) << beacon.cpu_optimizations << "│\n";
+        log << "└─────────────────────────────────────────┘\n";
+        
+        log << health.health_icon << " Beacon status: " << BeaconStatus::healthLabel(health.overall_status) << "\n";
+        log << "   Parse time: " << beacon.parse_time.count() << "µs | Validation: ✅\n";
+        
+        if (*health.concerns) {
+            log << "   ⚠️  Concerns: " << health.concerns << "\n";
         }
         
-        std::cout << "═══════════════════════════════════════════\n\n";
+        log << "═══════════════════════════════════════════\n\n";
     }
     
     void display_performance_summary() {
         auto now = std::chrono::system_clock::now();
         auto uptime = std::chrono::duration_cast<std::chrono::seconds>(now - stats.start_time);
         
+        // Pending beacon records first, so the summary isn't interleaved with them
+        AsyncLog::logger().flush();
+        
         std::cout << "\n📊 LISTENER PERFORMANCE SUMMARY 📊\n";
         std::cout << "════════════════════════════════════════\n";
         std::cout << "⏱️  Uptime: " << uptime.count() << " seconds\n";
@@ -294,6 +166,7 @@ private:
         std::cout << "%\n";
         
         std::cout << "💾 Total Bytes: " << stats.total_bytes.load() << "\n";
+        std::cout << "📉 Kernel Drops: " << stats.kernel_drops.total() << " (socket queue overflow)\n";
         std::cout << "⚡ Avg Parse Time: " << std::fixed << std::setprecision(2) 
                  << json_parser.getAverageParseTime() << "µs\n";
         std::cout << "🚀 Parse Rate: " << json_parser.getTotalParses() << " parses\n";
@@ -330,7 +203,10 @@ public:
             return false;
         }
         
+        auto tuning = ListenerSocket::configureListenerSocket(udp_socket);
+        
         std::cout << "✅ Listener initialized successfully\n";
+        ListenerSocket::displaySocketTuning(tuning);
         std::cout << "🎧 Listening on port " << listen_port << " for lighthouse beacons\n\n";
         
         return true;
@@ -348,12 +224,12 @@ public:
         
         char buffer[2048];
         sockaddr_in client_addr;
-        socklen_t addr_len = sizeof(client_addr);
+        ListenerSocket::ReceiveMetadata meta;
         int beacon_count = 0;
         
         while (running) {
-            int recv_len = recvfrom(udp_socket, buffer, sizeof(buffer) - 1, 0,
-                                   (sockaddr*)&client_addr, &addr_len);
+            long recv_len = ListenerSocket::receiveWithMetadata(udp_socket, buffer, sizeof(buffer) - 1,
+                                                                &client_addr, meta);
             
             if (recv_len > 0) {
                 buffer[recv_len] = '\0';
@@ -362,9 +238,17 @@ public:
                 stats.total_beacons++;
                 stats.total_bytes += recv_len;
                 
-                // Parse beacon
+                if (uint32_t dropped = stats.kernel_drops.observe(meta)) {
+                    AsyncLog::Record().timestamp() << "📉 Kernel dropped " << dropped
+                                                   << " datagram(s) - socket queue overflowed\n";
+                }
+                
+                // Parse beacon (kernel arrival time when available, not our wakeup time)
                 BeaconData beacon;
-                beacon.received_time = std::chrono::system_clock::now();
+                beacon.received_time = meta.kernel_rx_ns
+                    ? std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                          std::chrono::nanoseconds(meta.kernel_rx_ns)))
+                    : std::chrono::system_clock::now();
                 
                 char client_ip[INET_ADDRSTRLEN];
                 inet_ntop(AF_INET, &client_addr.sin_addr, client_ip, INET_ADDRSTRLEN);
@@ -391,9 +275,8 @@ public:
                         display_performance_summary();
                     }
                 } else {
-                    print_timestamp();
-                    std::cout << "❌ Failed to parse beacon #" << beacon_count << "\n";
-                    std::cout << "📄 Raw data: " << std::string(buffer) << "\n\n";
+                    AsyncLog::Record().timestamp() << "❌ Failed to parse beacon #" << beacon_count << "\n"
+                                                   << "📄 Raw data: " << std::string_view(buffer) << "\n\n";
                 }
             }
         }
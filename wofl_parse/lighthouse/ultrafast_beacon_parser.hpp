@@ -0,0 +1,153 @@
+#ifndef ULTRAFAST_BEACON_PARSER_HPP
+#define ULTRAFAST_BEACON_PARSER_HPP
+
+// Hand-rolled beacon field extractor used by ultimate_listener.cpp.
+// Lives in a header so json_benchmark.cpp can race it against the other parsers.
+
+#include <string>
+#include <chrono>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+
+#include "beacon_status.hpp"
+
+// ==== BEACON DATA STRUCTURE ====
+struct BeaconData {
+    std::string beacon_id;
+    uint64_t timestamp{0};
+    std::string status;
+    std::string last_ping_status;
+    BeaconStatus::Health health{BeaconStatus::Health::Unknown};        // decoded from status
+    BeaconStatus::PingStatus ping{BeaconStatus::PingStatus::Unknown};  // decoded from last_ping_status
+    double ping_latency{0.0};
+    uint64_t signal_age_seconds{0};
+    double parse_throughput_mbps{0.0};
+    std::string cpu_optimizations;
+    uint64_t trace_send_ns{0};   // 0 when the sender predates latency tracing
+    
+    // Reception metadata
+    std::chrono::system_clock::time_point received_time;
+    std::string sender_ip;
+    int sender_port{0};
+    size_t payload_size{0};
+    std::chrono::microseconds parse_time{0};
+    bool valid{false};
+};
+
+// ==== ULTRA-FAST JSON PROCESSOR ====
+class UltraFastBeaconParser {
+private:
+    std::atomic<uint64_t> total_parses{0};
+    std::atomic<double> average_parse_time{0.0};
+
+public:
+    bool parseBeaconPayload(const std::string& json, BeaconData& beacon) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        
+        beacon.valid = false;
+        beacon.payload_size = json.size();
+        
+        // Ultra-optimized field extraction using RTC-inspired techniques
+        if (!extractStringField(json, "beacon_id", beacon.beacon_id)) return false;
+        if (!extractStringField(json, "status", beacon.status)) return false;
+        
+        extractStringField(json, "last_ping_status", beacon.last_ping_status);
+        extractStringField(json, "cpu_optimizations", beacon.cpu_optimizations);
+        beacon.health = BeaconStatus::decodeHealth(beacon.status);
+        beacon.ping = BeaconStatus::decodePing(beacon.last_ping_status);
+        
+        // Extract numeric fields
+        extractUint64Field(json, "timestamp", beacon.timestamp);
+        extractDoubleField(json, "ping_latency", beacon.ping_latency);
+        extractUint64Field(json, "signal_age_seconds", beacon.signal_age_seconds);
+        extractDoubleField(json, "parse_throughput_mbps", beacon.parse_throughput_mbps);
+        extractUint64Field(json, "trace_send_ns", beacon.trace_send_ns);
+        
+        auto end_time = std::chrono::high_resolution_clock::now();
+        beacon.parse_time = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+        
+        updatePerformanceMetrics(beacon.parse_time);
+        
+        beacon.valid = true;
+        return true;
+    }
+    
+    double getAverageParseTime() const {
+        return average_parse_time.load();
+    }
+    
+    uint64_t getTotalParses() const {
+        return total_parses.load();
+    }
+
+private:
+    bool extractStringField(const std::string& json, const std::string& key, std::string& value) {
+        std::string search_key = "\"" + key + "\":\"";
+        size_t start = json.find(search_key);
+        if (start == std::string::npos) return false;
+        
+        start += search_key.length();
+        size_t end = json.find("\"", start);
+        if (end == std::string::npos) return false;
+        
+        value = json.substr(start, end - start);
+        return true;
+    }
+    
+    bool extractDoubleField(const std::string& json, const std::string& key, double& value) {
+        std::string search_key = "\"" + key + "\":";
+        size_t start = json.find(search_key);
+        if (start == std::string::npos) return false;
+        
+        start += search_key.length();
+        size_t end = start;
+        while (end < json.length() && (std::isdigit(json[end]) || json[end] == '.' || json[end] == '-')) {
+            end++;
+        }
+        
+        if (end > start) {
+            try {
+                value = std::stod(json.substr(start, end - start));
+                return true;
+            } catch (...) {
+                return false;
+            }
+        }
+        return false;
+    }
+    
+    bool extractUint64Field(const std::string& json, const std::string& key, uint64_t& value) {
+        std::string search_key = "\"" + key + "\":";
+        size_t start = json.find(search_key);
+        if (start == std::string::npos) return false;
+        
+        start += search_key.length();
+        size_t end = start;
+        while (end < json.length() && std::isdigit(json[end])) {
+            end++;
+        }
+        
+        if (end > start) {
+            try {
+                value = std::stoull(json.substr(start, end - start));
+                return true;
+            } catch (...) {
+                return false;
+            }
+        }
+        return false;
+    }
+    
+    void updatePerformanceMetrics(std::chrono::microseconds parse_time) {
+        total_parses++;
+        
+        // Exponential moving average for parse time
+        double alpha = 0.1;
+        double current_avg = average_parse_time.load();
+        double new_time = parse_time.count();
+        average_parse_time.store(current_avg * (1.0 - alpha) + new_time * alpha);
+    }
+};
+
+#endif
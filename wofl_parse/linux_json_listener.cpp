@@ -7,129 +7,88 @@
 #include <unistd.h>
 #include <cstring>
 #include <chrono>
-#include <iomanip>
-#include <map>
+#include <string_view>
 
-void print_timestamp() {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::cout << "[" << std::put_time(std::localtime(&time_t), "%H:%M:%S") << "] ";
-}
+#include "tape_dom.hpp"
+#include "listener_socket.hpp"
+#include "async_logger.hpp"
 
-// Simple JSON parser - extracts key-value pairs
-std::map<std::string, std::string> parse_json_simple(const std::string& json) {
-    std::map<std::string, std::string> result;
-    
-    if (json.empty() || json[0] != '{') {
-        return result;  // Not JSON
-    }
-    
-    size_t pos = 1;  // Skip opening '{'
+// Scalars as text; containers as a size, their contents are listed separately
+void append_value(AsyncLog::Record& log, TapeDom::Element value) {
+    std::string_view text;
+    int64_t integer;
+    double number;
+    bool flag;
     
-    while (pos < json.length()) {
-        // Skip whitespace
-        while (pos < json.length() && (json[pos] == ' ' || json[pos] == '\t' || json[pos] == '\n')) {
-            pos++;
-        }
-        
-        if (pos >= json.length() || json[pos] == '}') break;
+    if (value.getString(text)) log << text;
+    else if (value.getInt64(integer)) log << integer;
+    else if (value.getDouble(number)) log << number;
+    else if (value.getBool(flag)) log << (flag ? "true" : "false");
+    else if (value.isObject()) log << "{" << value.size() << " fields}";
+    else if (value.isArray()) log << "[" << value.size() << " items]";
+    else log << "null";
+}
+
+// Every field of an object, nested objects flattened to dotted keys
+void append_fields(AsyncLog::Record& log, TapeDom::Element object, const std::string& prefix) {
+    object.forEachField([&](std::string_view key, TapeDom::Element value) {
+        if (prefix.empty() && (key == "status" || key == "id" || key == "time")) return;
+        std::string path = prefix + std::string(key);
         
-        // Find key (should be in quotes)
-        if (json[pos] == '"') {
-            pos++;  // Skip opening quote
-            size_t key_start = pos;
-            
-            // Find closing quote for key
-            while (pos < json.length() && json[pos] != '"') {
-                pos++;
-            }
-            
-            if (pos >= json.length()) break;
-            
-            std::string key = json.substr(key_start, pos - key_start);
-            pos++;  // Skip closing quote
-            
-            // Skip whitespace and colon
-            while (pos < json.length() && (json[pos] == ' ' || json[pos] == ':' || json[pos] == '\t')) {
-                pos++;
-            }
-            
-            // Get value
-            std::string value;
-            if (pos < json.length()) {
-                if (json[pos] == '"') {
-                    // String value
-                    pos++;  // Skip opening quote
-                    size_t value_start = pos;
-                    
-                    while (pos < json.length() && json[pos] != '"') {
-                        pos++;
-                    }
-                    
-                    if (pos < json.length()) {
-                        value = json.substr(value_start, pos - value_start);
-                        pos++;  // Skip closing quote
-                    }
-                } else {
-                    // Number or other value
-                    size_t value_start = pos;
-                    
-                    while (pos < json.length() && json[pos] != ',' && json[pos] != '}' && json[pos] != ' ') {
-                        pos++;
-                    }
-                    
-                    value = json.substr(value_start, pos - value_start);
-                }
-                
-                result[key] = value;
-            }
-            
-            // Skip comma
-            while (pos < json.length() && (json[pos] == ',' || json[pos] == ' ' || json[pos] == '\t')) {
-                pos++;
-            }
-        } else {
-            pos++;  // Skip invalid character
+        if (value.isObject() && value.size() > 0) {
+            append_fields(log, value, path + ".");
+            return;
         }
-    }
-    
-    return result;
+        log << "        📋 " << path << ": ";
+        append_value(log, value);
+        log << "\n";
+    });
 }
 
-void process_json_packet(const std::string& data, const std::string& client_ip, int client_port, int packet_num) {
-    print_timestamp();
-    std::cout << "📦 PKT#" << packet_num << " FROM " << client_ip << ":" << client_port << std::endl;
+// Per-packet output goes through the async sink: one record per packet, no flush per line.
+// The document is reused for every packet, so parsing allocates nothing once warm.
+void process_json_packet(TapeDom::Document& document, std::string_view data, const char* client_ip,
+                         int client_port, int packet_num) {
+    AsyncLog::Record log;
+    log.timestamp() << "📦 PKT#" << packet_num << " FROM " << client_ip << ":" << client_port << "\n";
     
-    auto parsed = parse_json_simple(data);
+    ParseResult::ParseOutcome outcome = document.load(data);
+    TapeDom::Element root = document.root();
     
-    if (parsed.empty()) {
-        std::cout << "     📄 RAW DATA: " << data << std::endl;
+    if (!outcome.ok() || !root.isObject()) {
+        if (!outcome.ok()) {
+            log << "     ⚠️  NOT JSON: " << ParseResult::errorKindName(outcome.kind)
+                << " at byte " << outcome.offset << "\n";
+        }
+        log << "     📄 RAW DATA: " << data << "\n";
     } else {
-        std::cout << "     ✅ PARSED JSON:" << std::endl;
+        log << "     ✅ PARSED JSON:\n";
         
         // Display common beacon fields with nice formatting
-        if (parsed.count("status")) {
-            std::cout << "        🚨 Status: " << parsed["status"] << std::endl;
+        if (TapeDom::Element status = root["status"]; status.exists()) {
+            log << "        🚨 Status: ";
+            append_value(log, status);
+            log << "\n";
         }
-        if (parsed.count("id")) {
-            std::cout << "        🏷️  ID: " << parsed["id"] << std::endl;
+        if (TapeDom::Element id = root["id"]; id.exists()) {
+            log << "        🏷️  ID: ";
+            append_value(log, id);
+            log << "\n";
         }
-        if (parsed.count("time")) {
-            std::cout << "        ⏰ Time: " << parsed["time"] << std::endl;
+        if (TapeDom::Element time = root["time"]; time.exists()) {
+            log << "        ⏰ Time: ";
+            append_value(log, time);
+            log << "\n";
         }
         
         // Show any other fields
-        for (const auto& [key, value] : parsed) {
-            if (key != "status" && key != "id" && key != "time") {
-                std::cout << "        📋 " << key << ": " << value << std::endl;
-            }
-        }
+        append_fields(log, root, "");
         
-        std::cout << "     📄 RAW: " << data << std::endl;
+        log << "     📄 RAW: " << data << "\n";
     }
     
-    std::cout << "     📏 SIZE: " << data.length() << " bytes" << std::endl;
-    std::cout << "═══════════════════════════════════════════\n";
+    log << "     📏 SIZE: " << data.length() << " bytes\n";
+    log << "═══════════════════════════════════════════\n";
 }
 
 int main() {
@@ -161,24 +120,33 @@ int main() {
         return 1;
     }
 
+    ListenerSocket::displaySocketTuning(ListenerSocket::configureListenerSocket(sock));
+
     char buffer[1024];
     sockaddr_in client_addr;
-    socklen_t addr_len = sizeof(client_addr);
+    ListenerSocket::ReceiveMetadata meta;
+    ListenerSocket::KernelDropCounter kernel_drops;
+    TapeDom::Document document;
     int packet_count = 0;
 
     while (true) {
-        int recv_len = recvfrom(sock, buffer, sizeof(buffer) - 1, 0, 
-                               (sockaddr*)&client_addr, &addr_len);
+        long recv_len = ListenerSocket::receiveWithMetadata(sock, buffer, sizeof(buffer) - 1,
+                                                            &client_addr, meta);
         
         if (recv_len > 0) {
             buffer[recv_len] = '\0';
             packet_count++;
             
+            if (uint32_t dropped = kernel_drops.observe(meta)) {
+                AsyncLog::Record().timestamp() << "📉 KERNEL DROPPED " << dropped << " PKT(S) (total "
+                                               << kernel_drops.total() << ")\n";
+            }
+            
             char client_ip[INET_ADDRSTRLEN];
             inet_ntop(AF_INET, &client_addr.sin_addr, client_ip, INET_ADDRSTRLEN);
             
-            process_json_packet(std::string(buffer), std::string(client_ip), 
-                              ntohs(client_addr.sin_port), packet_count);
+            process_json_packet(document, std::string_view(buffer, static_cast<size_t>(recv_len)), client_ip,
+                                ntohs(client_addr.sin_port), packet_count);
         }
     }
 
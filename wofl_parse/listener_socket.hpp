@@ -0,0 +1,205 @@
+#ifndef LISTENER_SOCKET_HPP
+#define LISTENER_SOCKET_HPP
+
+// 🎧 Shared UDP listener socket setup
+// - Large receive buffer (SO_RCVBUFFORCE when privileged, SO_RCVBUF otherwise)
+// - Kernel RX timestamps (SO_TIMESTAMPING, SO_TIMESTAMPNS as fallback)
+// - SO_RXQ_OVFL: the kernel's cumulative count of datagrams dropped because
+//   the socket queue was full. That is loss *on this host*, as opposed to a
+//   sequence gap, which also counts packets lost on the wire.
+// On Windows only the receive buffer is applied and metadata stays zero.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <time.h>
+    #ifdef __linux__
+        #include <linux/net_tstamp.h>
+    #endif
+#endif
+
+namespace ListenerSocket {
+
+// 4 MiB holds several seconds of beacon bursts; the kernel doubles what we ask for
+constexpr int default_receive_buffer_bytes = 4 * 1024 * 1024;
+
+struct SocketTuning {
+    int requested_receive_buffer{ 0 };
+    int effective_receive_buffer{ 0 };
+    bool receive_buffer_forced{ false };    // SO_RCVBUFFORCE bypassed net.core.rmem_max
+    bool kernel_timestamps{ false };
+    bool drop_counter{ false };
+};
+
+struct ReceiveMetadata {
+    uint64_t kernel_rx_ns{ 0 };             // 0 when the kernel attached no timestamp
+    bool has_drop_count{ false };
+    uint32_t cumulative_drops{ 0 };         // SO_RXQ_OVFL value at this datagram
+};
+
+#ifndef _WIN32
+// Room for SCM_TIMESTAMPING (3 timespecs) or SCM_TIMESTAMPNS, plus SO_RXQ_OVFL
+struct alignas(cmsghdr) ControlBuffer {
+    char data[CMSG_SPACE(3 * sizeof(timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+};
+#endif
+
+inline SocketTuning configureListenerSocket(int fd, int receive_buffer_bytes = default_receive_buffer_bytes) {
+    SocketTuning tuning{};
+    tuning.requested_receive_buffer = receive_buffer_bytes;
+
+    #ifdef SO_RCVBUFFORCE
+        tuning.receive_buffer_forced = setsockopt(fd, SOL_SOCKET, SO_RCVBUFFORCE,
+                                                  &receive_buffer_bytes, sizeof(receive_buffer_bytes)) == 0;
+    #endif
+    if (!tuning.receive_buffer_forced) {
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF,
+                   reinterpret_cast<const char*>(&receive_buffer_bytes), sizeof(receive_buffer_bytes));
+    }
+
+    socklen_t len = sizeof(tuning.effective_receive_buffer);
+    getsockopt(fd, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char*>(&tuning.effective_receive_buffer), &len);
+
+    #if defined(SO_TIMESTAMPING) && defined(__linux__)
+        // Software stamps only: they are CLOCK_REALTIME, like the user-space stamps
+        // they are subtracted from. Hardware stamps are NIC (PHC) time and would
+        // also need SIOCSHWTSTAMP on the interface.
+        int timestamping = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        tuning.kernel_timestamps = setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING,
+                                              &timestamping, sizeof(timestamping)) == 0;
+    #endif
+    #ifdef SO_TIMESTAMPNS
+        if (!tuning.kernel_timestamps) {
+            int enable = 1;
+            tuning.kernel_timestamps = setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) == 0;
+        }
+    #endif
+
+    #ifdef SO_RXQ_OVFL
+        int enable_overflow = 1;
+        tuning.drop_counter = setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &enable_overflow, sizeof(enable_overflow)) == 0;
+    #endif
+
+    return tuning;
+}
+
+inline void displaySocketTuning(const SocketTuning& tuning) {
+    std::cout << "🧰 Socket: RCVBUF " << tuning.effective_receive_buffer / 1024 << " KiB"
+             << (tuning.receive_buffer_forced ? " (forced)" : "")
+             << " | Kernel RX timestamps: " << (tuning.kernel_timestamps ? "✅" : "❌")
+             << " | Drop counter: " << (tuning.drop_counter ? "✅" : "❌") << "\n";
+
+    // Without CAP_NET_ADMIN the request is silently capped at net.core.rmem_max
+    if (!tuning.receive_buffer_forced && tuning.effective_receive_buffer < tuning.requested_receive_buffer) {
+        std::cout << "⚠️  Receive buffer capped by net.core.rmem_max (asked for "
+                 << tuning.requested_receive_buffer / 1024 << " KiB)\n";
+    }
+}
+
+#ifndef _WIN32
+// Folds one SOL_SOCKET control message into meta; shared by recvmsg and io_uring paths
+inline void applyControlMessage(const cmsghdr* cmsg, ReceiveMetadata& meta) {
+    if (cmsg->cmsg_level != SOL_SOCKET) return;
+
+    #ifdef SCM_TIMESTAMPING
+        if (cmsg->cmsg_type == SCM_TIMESTAMPING) {
+            // [0] software (CLOCK_REALTIME), [1] legacy, [2] raw hardware (PHC clock, not comparable)
+            timespec ts[3]{};
+            std::memcpy(ts, CMSG_DATA(cmsg), sizeof(ts));
+            meta.kernel_rx_ns = static_cast<uint64_t>(ts[0].tv_sec) * 1000000000ULL
+                              + static_cast<uint64_t>(ts[0].tv_nsec);
+            return;
+        }
+    #endif
+    #ifdef SCM_TIMESTAMPNS
+        if (cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+            timespec ts{};
+            std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+            meta.kernel_rx_ns = static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL
+                              + static_cast<uint64_t>(ts.tv_nsec);
+            return;
+        }
+    #endif
+    #ifdef SO_RXQ_OVFL
+        if (cmsg->cmsg_type == SO_RXQ_OVFL) {
+            std::memcpy(&meta.cumulative_drops, CMSG_DATA(cmsg), sizeof(uint32_t));
+            meta.has_drop_count = true;
+        }
+    #endif
+}
+
+inline ReceiveMetadata parseReceiveMetadata(msghdr& hdr) {
+    ReceiveMetadata meta{};
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+        applyControlMessage(cmsg, meta);
+    }
+    return meta;
+}
+#endif
+
+// 📥 recvfrom() with kernel metadata, for listeners that read one datagram at a time.
+// truncated (optional) is set when the datagram was longer than the buffer:
+// the kernel kept the first length bytes and threw the rest away.
+inline long receiveWithMetadata(int fd, char* buffer, size_t length, sockaddr_in* source, ReceiveMetadata& meta,
+                                bool* truncated = nullptr) {
+    meta = ReceiveMetadata{};
+    if (truncated) *truncated = false;
+
+    #ifdef _WIN32
+        int source_len = sizeof(sockaddr_in);
+        int received = recvfrom(fd, buffer, static_cast<int>(length), 0, reinterpret_cast<sockaddr*>(source), &source_len);
+        // Windows reports an oversize datagram as an error, after filling the buffer
+        if (received == SOCKET_ERROR && WSAGetLastError() == WSAEMSGSIZE && truncated) {
+            *truncated = true;
+            return static_cast<long>(length);
+        }
+        return received;
+    #else
+        iovec iov{ buffer, length };
+        ControlBuffer control{};
+
+        msghdr hdr{};
+        hdr.msg_name = source;
+        hdr.msg_namelen = sizeof(sockaddr_in);
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = control.data;
+        hdr.msg_controllen = sizeof(control.data);
+
+        ssize_t received = recvmsg(fd, &hdr, 0);
+        if (received > 0) {
+            meta = parseReceiveMetadata(hdr);
+            if (truncated) *truncated = (hdr.msg_flags & MSG_TRUNC) != 0;
+        }
+        return static_cast<long>(received);
+    #endif
+}
+
+// 📉 Tracks the kernel's SO_RXQ_OVFL counter (cumulative since the socket opened)
+// Observed from the receive thread, readable from any other.
+class KernelDropCounter {
+private:
+    std::atomic<uint32_t> last_seen{ 0 };
+
+public:
+    // Returns how many datagrams the kernel dropped since the previous observation
+    uint32_t observe(const ReceiveMetadata& meta) {
+        if (!meta.has_drop_count) return 0;
+        uint32_t previous = last_seen.exchange(meta.cumulative_drops, std::memory_order_relaxed);
+        return meta.cumulative_drops - previous;   // unsigned wrap is intended
+    }
+
+    uint32_t total() const { return last_seen.load(std::memory_order_relaxed); }
+};
+
+} // namespace ListenerSocket
+
+#endif // LISTENER_SOCKET_HPP
@@ -0,0 +1,262 @@
+#ifndef NDJSON_READER_HPP
+#define NDJSON_READER_HPP
+
+// 📜 NDJSON / JSON-sequence reader for offline replay
+// A capture file (one JSON document per line; RFC 7464 record separators
+// and CRLF line ends are tolerated) is memory-mapped, cut into chunks at
+// newline boundaries, and the chunks are handed to a pool of threads. Each
+// thread builds its own worker once - so every thread reuses its own parser
+// and buffers - and the per-chunk results come back in file order.
+//
+// Newlines are found 32 bytes at a time with AVX2 where available, memchr
+// elsewhere. Records are views into the mapping: no copies, no line buffers.
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "cpu_dispatch.hpp"
+
+namespace Ndjson {
+
+// 🗺️ Read-only mapping of a whole file
+class MappedFile {
+private:
+    const char* bytes{ nullptr };
+    size_t length{ 0 };
+    std::string last_error{};
+    #ifdef _WIN32
+        HANDLE file{ INVALID_HANDLE_VALUE };
+        HANDLE mapping{ nullptr };
+    #endif
+
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+    bool open(const std::string& path) {
+        close();
+        #ifdef _WIN32
+            file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                last_error = "cannot open " + path;
+                return false;
+            }
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size)) {
+                last_error = "cannot stat " + path;
+                close();
+                return false;
+            }
+            length = static_cast<size_t>(size.QuadPart);
+            if (length == 0) return true;
+
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (!view) {
+                last_error = "cannot map " + path;
+                close();
+                return false;
+            }
+            bytes = static_cast<const char*>(view);
+        #else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                last_error = "cannot open " + path + ": " + std::strerror(errno);
+                return false;
+            }
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                last_error = "cannot stat " + path + ": " + std::strerror(errno);
+                ::close(fd);
+                return false;
+            }
+            length = static_cast<size_t>(info.st_size);
+            if (length == 0) {
+                ::close(fd);
+                return true;
+            }
+
+            void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);   // the mapping keeps the file alive
+            if (view == MAP_FAILED) {
+                last_error = "cannot map " + path + ": " + std::strerror(errno);
+                length = 0;
+                return false;
+            }
+            madvise(view, length, MADV_SEQUENTIAL);
+            bytes = static_cast<const char*>(view);
+        #endif
+        return true;
+    }
+
+    void close() {
+        #ifdef _WIN32
+            if (bytes) UnmapViewOfFile(bytes);
+            if (mapping) CloseHandle(mapping);
+            if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+            mapping = nullptr;
+            file = INVALID_HANDLE_VALUE;
+        #else
+            if (bytes) munmap(const_cast<char*>(bytes), length);
+        #endif
+        bytes = nullptr;
+        length = 0;
+    }
+
+    std::string_view data() const { return { bytes ? bytes : "", length }; }
+    const std::string& error() const { return last_error; }
+};
+
+namespace detail {
+
+#ifdef CPU_DISPATCH_X86
+CPU_DISPATCH_TARGET_AVX2 inline size_t nextNewlineAvx2(std::string_view text, size_t from) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    size_t pos = from;
+    for (; pos + 32 <= text.size(); pos += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + pos));
+        uint32_t hits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+        if (hits) return pos + static_cast<size_t>(std::countr_zero(hits));
+    }
+    // Never read past the mapping: the tail goes through memchr
+    const void* hit = std::memchr(text.data() + pos, '\n', text.size() - pos);
+    return hit ? static_cast<size_t>(static_cast<const char*>(hit) - text.data()) : text.size();
+}
+#endif
+
+} // namespace detail
+
+// Offset of the next '\n' at or after from, or text.size()
+inline size_t nextNewline(std::string_view text, size_t from) {
+    if (from >= text.size()) return text.size();
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) return detail::nextNewlineAvx2(text, from);
+    #endif
+    const void* hit = std::memchr(text.data() + from, '\n', text.size() - from);
+    return hit ? static_cast<size_t>(static_cast<const char*>(hit) - text.data()) : text.size();
+}
+
+// 🧩 A run of whole lines; offset is where it starts in the file
+struct Chunk {
+    std::string_view text;
+    size_t offset{ 0 };
+    size_t index{ 0 };
+
+    // Calls record(json, file_offset) for every non-blank line, with
+    // surrounding whitespace and RFC 7464 record separators (0x1E) trimmed
+    template <typename Fn>
+    void forEachRecord(Fn&& record) const {
+        auto is_padding = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\x1E'; };
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t end = nextNewline(text, pos);
+            size_t start = pos;
+            size_t stop = end;
+            while (start < stop && is_padding(text[start])) ++start;
+            while (stop > start && is_padding(text[stop - 1])) --stop;
+            if (stop > start) record(text.substr(start, stop - start), offset + start);
+            pos = end + 1;
+        }
+    }
+};
+
+// Cuts data into about target_bytes-sized chunks, each ending just after a newline
+inline std::vector<Chunk> splitChunks(std::string_view data, size_t target_bytes) {
+    std::vector<Chunk> chunks;
+    target_bytes = std::max<size_t>(target_bytes, 1);
+    size_t begin = 0;
+    while (begin < data.size()) {
+        size_t end = begin + target_bytes;
+        end = end >= data.size() ? data.size() : std::min(nextNewline(data, end) + 1, data.size());
+        chunks.push_back({ data.substr(begin, end - begin), begin, chunks.size() });
+        begin = end;
+    }
+    return chunks;
+}
+
+// 🧵 Runs make_worker() once per thread, then worker(chunk) on every chunk.
+// Returns one result per chunk, in file order. threads = 0 uses every core.
+template <typename MakeWorker>
+auto processChunks(std::string_view data, MakeWorker make_worker, unsigned threads = 0,
+                   size_t chunk_bytes = 4 << 20) {
+    using Worker = std::invoke_result_t<MakeWorker&>;
+    using Result = std::invoke_result_t<Worker&, const Chunk&>;
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    // Several chunks per thread so an uneven file still keeps every core busy
+    if (data.size() / chunk_bytes < threads * 4) chunk_bytes = std::max<size_t>(data.size() / (threads * 4), 64 << 10);
+
+    std::vector<Chunk> chunks = splitChunks(data, chunk_bytes);
+    std::vector<Result> results(chunks.size());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, chunks.size()));
+
+    std::atomic<size_t> next_chunk{ 0 };
+    auto run = [&]() {
+        Worker worker = make_worker();
+        for (size_t i = next_chunk.fetch_add(1, std::memory_order_relaxed); i < chunks.size();
+             i = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+            results[i] = worker(chunks[i]);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(run);
+    if (threads > 0) run();
+    for (auto& thread : pool) thread.join();
+    return results;
+}
+
+// Per-record convenience: worker(json, file_offset) for every record, results flattened in file order
+template <typename MakeWorker>
+auto mapRecords(std::string_view data, MakeWorker make_worker, unsigned threads = 0) {
+    using Worker = std::invoke_result_t<MakeWorker&>;
+    using Result = std::invoke_result_t<Worker&, std::string_view, size_t>;
+
+    struct ChunkWorker {
+        Worker worker;
+        std::vector<Result> operator()(const Chunk& chunk) {
+            std::vector<Result> out;
+            chunk.forEachRecord([&](std::string_view json, size_t offset) { out.push_back(worker(json, offset)); });
+            return out;
+        }
+    };
+
+    auto per_chunk = processChunks(data, [&]() { return ChunkWorker{ make_worker() }; }, threads);
+    size_t total = 0;
+    for (const auto& results : per_chunk) total += results.size();
+
+    std::vector<Result> merged;
+    merged.reserve(total);
+    for (auto& results : per_chunk) std::move(results.begin(), results.end(), std::back_inserter(merged));
+    return merged;
+}
+
+} // namespace Ndjson
+
+#endif // NDJSON_READER_HPP
@@ -0,0 +1,160 @@
+// ndjson_replay.cpp - offline replay of archived beacon logs and captured FastPing responses
+// Usage: ndjson_replay <capture.ndjson> [threads]
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "ndjson_reader.hpp"
+#include "tape_dom.hpp"
+
+// Lets the per-beacon map be probed with the string_view the tape hands back,
+// so a record only allocates when it brings a beacon id the chunk has not seen
+struct BeaconIdHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view id) const { return std::hash<std::string_view>{}(id); }
+};
+
+using BeaconCounts = std::unordered_map<std::string, uint64_t, BeaconIdHash, std::equal_to<>>;
+
+// Everything one chunk contributes to the report; merged in file order
+struct ReplayStats {
+    uint64_t records = 0;
+    uint64_t beacons = 0;
+    uint64_t fastping_responses = 0;
+    uint64_t other = 0;
+    std::array<uint64_t, static_cast<size_t>(ParseResult::ParseErrorKind::Count)> failures{};
+    std::vector<std::pair<size_t, ParseResult::ParseOutcome>> first_failures;   // file offset, outcome
+    BeaconCounts records_per_beacon;
+
+    static constexpr size_t max_failures_listed = 10;
+
+    void merge(ReplayStats& chunk) {
+        records += chunk.records;
+        beacons += chunk.beacons;
+        fastping_responses += chunk.fastping_responses;
+        other += chunk.other;
+        for (size_t i = 0; i < failures.size(); ++i) failures[i] += chunk.failures[i];
+        for (auto& failure : chunk.first_failures) {
+            if (first_failures.size() == max_failures_listed) break;
+            first_failures.push_back(failure);
+        }
+        for (auto& node : chunk.records_per_beacon) {
+            auto counted = records_per_beacon.find(node.first);
+            if (counted != records_per_beacon.end()) {
+                counted->second += node.second;
+            } else {
+                records_per_beacon.insert(std::move(node));
+            }
+        }
+    }
+
+    uint64_t failureTotal() const {
+        uint64_t total = 0;
+        for (uint64_t n : failures) total += n;
+        return total;
+    }
+};
+
+// One per thread: the document's tape and string arena are reused for every record
+struct ReplayWorker {
+    TapeDom::Document document;
+
+    ReplayStats operator()(const Ndjson::Chunk& chunk) {
+        ReplayStats stats;
+        chunk.forEachRecord([&](std::string_view json, size_t offset) {
+            ++stats.records;
+            ParseResult::ParseOutcome outcome = document.load(json);
+            if (!outcome.ok()) {
+                ++stats.failures[static_cast<size_t>(outcome.kind)];
+                if (stats.first_failures.size() < ReplayStats::max_failures_listed) {
+                    stats.first_failures.push_back({ offset + outcome.offset, outcome });
+                }
+                return;
+            }
+
+            TapeDom::Element root = document.root();
+            std::string_view beacon_id;
+            if (root["beacon_id"].getString(beacon_id)) {
+                ++stats.beacons;
+                auto counted = stats.records_per_beacon.find(beacon_id);
+                if (counted != stats.records_per_beacon.end()) {
+                    ++counted->second;
+                } else {
+                    stats.records_per_beacon.emplace(beacon_id, 1);
+                }
+            } else if (root["status"].exists()) {
+                ++stats.fastping_responses;
+            } else {
+                ++stats.other;
+            }
+        });
+        return stats;
+    }
+};
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <capture.ndjson> [threads]\n";
+        return 1;
+    }
+    unsigned threads = argc > 2 ? static_cast<unsigned>(std::stoul(argv[2])) : 0;
+
+    Ndjson::MappedFile file;
+    if (!file.open(argv[1])) {
+        std::cerr << "❌ " << file.error() << "\n";
+        return 1;
+    }
+    std::string_view data = file.data();
+
+    std::cout << "📼 FastPing NDJSON Replay\n";
+    std::cout << "=========================\n";
+    std::cout << "📂 " << argv[1] << " (" << data.size() << " bytes)\n";
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ReplayStats> per_chunk = Ndjson::processChunks(data, [] { return ReplayWorker{}; }, threads);
+    ReplayStats total;
+    for (auto& chunk : per_chunk) total.merge(chunk);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "⏱️  " << seconds * 1000.0 << " ms over " << per_chunk.size() << " chunks — "
+              << (seconds > 0 ? data.size() / seconds / 1e9 : 0.0) << " GB/s, "
+              << (seconds > 0 ? total.records / seconds / 1e6 : 0.0) << " M records/s\n";
+    std::cout << "📊 Records: " << total.records << " (beacons " << total.beacons
+              << ", FastPing responses " << total.fastping_responses << ", other " << total.other
+              << ", failed " << total.failureTotal() << ")\n";
+
+    if (total.failureTotal() > 0) {
+        std::cout << "⚠️  Parse Failures:";
+        for (size_t i = 1; i < total.failures.size(); ++i) {
+            if (total.failures[i] == 0) continue;
+            std::cout << " " << ParseResult::errorKindName(static_cast<ParseResult::ParseErrorKind>(i))
+                      << " " << total.failures[i];
+        }
+        std::cout << "\n";
+        for (const auto& [offset, outcome] : total.first_failures) {
+            std::cout << "     " << ParseResult::errorKindName(outcome.kind) << " at byte " << offset << "\n";
+        }
+    }
+
+    if (!total.records_per_beacon.empty()) {
+        std::vector<std::pair<std::string, uint64_t>> busiest(total.records_per_beacon.begin(),
+                                                              total.records_per_beacon.end());
+        std::sort(busiest.begin(), busiest.end(), [](const auto& a, const auto& b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        std::cout << "🏷️  Beacons: " << busiest.size() << "\n";
+        for (size_t i = 0; i < busiest.size() && i < 10; ++i) {
+            std::cout << "     " << busiest[i].first << ": " << busiest[i].second << " records\n";
+        }
+    }
+
+    return total.failureTotal() == 0 ? 0 : 2;
+}
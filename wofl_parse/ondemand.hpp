@@ -0,0 +1,203 @@
+#ifndef ONDEMAND_HPP
+#define ONDEMAND_HPP
+
+// 🎯 On-demand (lazy) access to the fields of a flat JSON object
+// load() runs the structural indexer and records where each top-level key
+// sits; no value is decoded. A getter finds its key, decodes just that value
+// and hands back numbers or string_views, so a consumer that reads three
+// fields of a thirty-field beacon pays for three.
+//
+// getString() decodes escape sequences: a string without any comes back as a
+// view into the caller's buffer, the rest are decoded once into the
+// Document's arena. getRawString() returns the bytes as they are on the wire.
+// Keys are compared decoded, and when a key appears more than once the first
+// occurrence wins - later duplicates are dropped at load().
+//
+// The buffer passed to load() must outlive every view taken from it, and
+// views into the arena last until the next load(). A Document is meant to be
+// reused: load() keeps its vectors' capacity.
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "json_number.hpp"
+#include "json_string.hpp"
+#include "structural_index.hpp"
+
+namespace OnDemand {
+
+class Document {
+private:
+    std::string_view json;
+    std::vector<uint32_t> structurals;
+    struct Field {
+        uint32_t key_index = 0;         // structural index of the key
+        std::string_view key;           // decoded
+        std::string_view value;         // decoded string value, once read
+        bool value_decoded = false;
+    };
+    std::vector<Field> fields;          // top-level fields, first occurrence of each key
+    std::vector<char> arena;            // decoded strings; reserved to the input size so views stay put
+    size_t next_field = 0;              // fields are usually read in wire order
+
+    char at(size_t index) const { return json[structurals[index]]; }
+
+    // Decoded contents of a raw string: the raw bytes themselves when there is
+    // nothing to decode, otherwise a view into the arena. Every string is
+    // decoded at most once and decoding never grows it, so the arena reserved
+    // in load() never reallocates.
+    bool decode(std::string_view raw, std::string_view& out) {
+        if (JsonString::findSpecial(raw) == raw.size()) {
+            out = raw;
+            return true;
+        }
+        size_t start = arena.size();
+        if (JsonString::unescapeInto(raw, arena) != raw.size()) {
+            arena.resize(start);
+            return false;
+        }
+        out = std::string_view(arena.data() + start, arena.size() - start);
+        return true;
+    }
+
+    // A cheap filter over the keys seen so far, so load() only compares
+    // keys that might be duplicates
+    static uint64_t keyBit(std::string_view key) {
+        size_t mix = key.size() * 31 + (key.empty() ? 0 : static_cast<unsigned char>(key.front()) * 7
+                                                        + static_cast<unsigned char>(key.back()));
+        return uint64_t{ 1 } << (mix & 63);
+    }
+
+    // Field holding key, or nullptr when the object has no such key. The scan
+    // starts after the last field found; keys are unique, so where it starts
+    // never changes which field it finds.
+    Field* find(std::string_view key) {
+        size_t count = fields.size();
+        for (size_t n = 0; n < count; ++n) {
+            size_t field = next_field + n < count ? next_field + n : next_field + n - count;
+            if (fields[field].key == key) {
+                next_field = field + 1 < count ? field + 1 : 0;
+                return &fields[field];
+            }
+        }
+        return nullptr;
+    }
+
+public:
+    // Indexes input and checks it is UTF-8 and its top level is one well-formed object
+    bool load(std::string_view input) {
+        json = input;
+        fields.clear();
+        arena.clear();
+        arena.reserve(input.size());
+        next_field = 0;
+
+        bool utf8_valid = true;
+        if (!StructuralIndex::buildValidated(json, structurals, utf8_valid) || !utf8_valid) return false;
+        if (structurals.empty() || at(0) != '{') return false;
+
+        size_t i = 1;
+        if (i < structurals.size() && at(i) == '}') return i + 1 == structurals.size();
+
+        uint64_t seen_keys = 0;
+        while (i + 2 < structurals.size()) {
+            if (at(i) != '"' || at(i + 1) != ':') return false;
+            char value = at(i + 2);
+            if (value == ',' || value == ':' || value == '}' || value == ']') return false;
+
+            Field field{};
+            field.key_index = static_cast<uint32_t>(i);
+            std::string_view raw;
+            if (!StructuralIndex::stringAt(json, structurals, i, raw) || !decode(raw, field.key)) return false;
+            uint64_t bit = keyBit(field.key);
+            bool duplicate = false;
+            if (seen_keys & bit) {
+                for (const Field& earlier : fields) {
+                    if (earlier.key == field.key) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+            }
+            if (!duplicate) {
+                seen_keys |= bit;
+                fields.push_back(field);
+            }
+
+            size_t after = 0;
+            if (!StructuralIndex::skipValue(json, structurals, i + 2, after)) return false;
+            if (after >= structurals.size()) return false;
+
+            if (at(after) == '}') return after + 1 == structurals.size();
+            if (at(after) != ',') return false;
+            i = after + 1;
+        }
+        return false;
+    }
+
+    // Distinct top-level keys
+    size_t fieldCount() const { return fields.size(); }
+
+    bool has(std::string_view key) { return find(key) != nullptr; }
+
+    // Decoded string contents; false if the key is missing, not a string or badly escaped
+    bool getString(std::string_view key, std::string_view& out) {
+        Field* field = find(key);
+        if (!field || at(field->key_index + 2) != '"') return false;
+        if (!field->value_decoded) {
+            std::string_view raw;
+            if (!StructuralIndex::stringAt(json, structurals, field->key_index + 2, raw)) return false;
+            if (!decode(raw, field->value)) return false;
+            field->value_decoded = true;
+        }
+        out = field->value;
+        return true;
+    }
+
+    // String contents exactly as on the wire, escape sequences included
+    bool getRawString(std::string_view key, std::string_view& out) {
+        Field* field = find(key);
+        if (!field || at(field->key_index + 2) != '"') return false;
+        return StructuralIndex::stringAt(json, structurals, field->key_index + 2, out);
+    }
+
+    // Integers and floating point; false if missing, not a JSON number or out of range for T
+    template <typename T>
+    bool getNumber(std::string_view key, T& out) {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "getNumber needs an arithmetic type");
+
+        Field* field = find(key);
+        if (!field) return false;
+
+        std::string_view text = StructuralIndex::scalarAt(json, structurals, field->key_index + 2);
+        if (!JsonNumber::isNumber(text)) return false;
+        T value{};
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc{} || end != text.data() + text.size()) return false;
+        out = value;
+        return true;
+    }
+
+    bool getBool(std::string_view key, bool& out) {
+        Field* field = find(key);
+        if (!field) return false;
+
+        std::string_view text = StructuralIndex::scalarAt(json, structurals, field->key_index + 2);
+        if (text == "true") {
+            out = true;
+        } else if (text == "false") {
+            out = false;
+        } else {
+            return false;
+        }
+        return true;
+    }
+};
+
+} // namespace OnDemand
+
+#endif // ONDEMAND_HPP
@@ -0,0 +1,281 @@
+#ifndef PARSE_OUTCOME_HPP
+#define PARSE_OUTCOME_HPP
+
+// 🩺 Exception-free parse results and failure classification
+// Parsers report a ParseOutcome (kind + byte offset) instead of throwing.
+// When a parse fails, diagnose() works out why from the structural index:
+// empty, invalid UTF-8, truncated, malformed, or - for a well-formed object
+// checked against a field schema - an unknown key, a missing field or a value
+// of the wrong type. It only runs on the failure path, and a junk-packet
+// flood costs one index pass per datagram, never an exception unwind.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json_number.hpp"
+#include "structural_index.hpp"
+#include "utf8_validate.hpp"
+
+namespace ParseResult {
+
+enum class ParseErrorKind : uint8_t {
+    None = 0,
+    Empty,
+    Truncated,       // input ends inside a string or an open object/array
+    InvalidUtf8,
+    Malformed,       // not JSON: stray characters, missing colons/commas, bad literals
+    UnknownKey,      // well-formed, but a key the schema does not have
+    WrongType,       // well-formed, but a value of the wrong JSON type
+    MissingField,    // well-formed, but a required field is absent
+    Rejected,        // parser refused input that passed every check above
+    Count
+};
+
+inline const char* errorKindName(ParseErrorKind kind) {
+    switch (kind) {
+        case ParseErrorKind::None: return "none";
+        case ParseErrorKind::Empty: return "empty";
+        case ParseErrorKind::Truncated: return "truncated";
+        case ParseErrorKind::InvalidUtf8: return "invalid UTF-8";
+        case ParseErrorKind::Malformed: return "malformed";
+        case ParseErrorKind::UnknownKey: return "unknown key";
+        case ParseErrorKind::WrongType: return "wrong type";
+        case ParseErrorKind::MissingField: return "missing field";
+        case ParseErrorKind::Rejected: return "rejected";
+        default: return "?";
+    }
+}
+
+struct ParseOutcome {
+    ParseErrorKind kind{ ParseErrorKind::None };
+    size_t offset{ 0 };              // byte where the problem was found
+
+    bool ok() const { return kind == ParseErrorKind::None; }
+
+    static ParseOutcome success() { return {}; }
+    static ParseOutcome failure(ParseErrorKind kind, size_t offset) { return { kind, offset }; }
+};
+
+// 📋 Expected top-level fields of a flat object
+enum class JsonType : uint8_t { String, Number, Bool, Object, Array, Null };
+
+inline const char* jsonTypeName(JsonType type) {
+    switch (type) {
+        case JsonType::String: return "string";
+        case JsonType::Number: return "number";
+        case JsonType::Bool: return "bool";
+        case JsonType::Object: return "object";
+        case JsonType::Array: return "array";
+        default: return "null";
+    }
+}
+
+struct FieldSpec {
+    std::string_view name;
+    JsonType type;
+    bool required{ false };
+};
+
+// 📊 Per-kind failure counters, safe to bump from any thread
+class ParseErrorCounters {
+private:
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(ParseErrorKind::Count)> counts{};
+
+public:
+    void record(ParseErrorKind kind) {
+        counts[static_cast<size_t>(kind)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t count(ParseErrorKind kind) const {
+        return counts[static_cast<size_t>(kind)].load(std::memory_order_relaxed);
+    }
+
+    // Failures only (None is not counted)
+    uint64_t total() const {
+        uint64_t sum = 0;
+        for (size_t i = 1; i < counts.size(); ++i) sum += counts[i].load(std::memory_order_relaxed);
+        return sum;
+    }
+
+    // e.g. "truncated 3, invalid UTF-8 1"; "none" when nothing has failed
+    std::string summary() const {
+        std::string text;
+        for (size_t i = 1; i < counts.size(); ++i) {
+            uint64_t n = counts[i].load(std::memory_order_relaxed);
+            if (n == 0) continue;
+            if (!text.empty()) text += ", ";
+            text += errorKindName(static_cast<ParseErrorKind>(i));
+            text += " ";
+            text += std::to_string(n);
+        }
+        return text.empty() ? "none" : text;
+    }
+};
+
+namespace detail {
+
+inline JsonType valueType(char first) {
+    switch (first) {
+        case '"': return JsonType::String;
+        case '{': return JsonType::Object;
+        case '[': return JsonType::Array;
+        case 't': case 'f': return JsonType::Bool;
+        case 'n': return JsonType::Null;
+        default: return JsonType::Number;
+    }
+}
+
+// Checks a number/literal token, as cut out by StructuralIndex::scalarAt
+inline bool validScalar(std::string_view text) {
+    return text == "true" || text == "false" || text == "null" || JsonNumber::isNumber(text);
+}
+
+} // namespace detail
+
+// 🧭 The grammar walk shared by diagnose() and TapeDom::Document::load()
+// Steps through the structurals checking each against what may come next,
+// and tells handler about every piece of the value as it passes:
+//   ParseOutcome key(i)     object key whose opening quote is structurals[i]
+//   ParseOutcome string(i)  string value; a failure is returned as is
+//   bool scalar(i)          number or literal; false makes it Malformed at i
+//   void open(c)            '{' or '[' starts a value
+//   void close(c)           the matching '}' or ']'
+// open is scratch for the stack of unclosed containers. Input that ends
+// before the value does is Truncated at json.size().
+template <typename Handler>
+ParseOutcome walkGrammar(std::string_view json, const std::vector<uint32_t>& structurals, bool strings_closed,
+                         std::vector<char>& open, Handler& handler) {
+    using Kind = ParseErrorKind;
+
+    enum class Expect { Value, KeyOrClose, Key, Colon, CommaOrClose, ValueOrClose, End };
+    Expect expect = Expect::Value;
+    open.clear();
+
+    for (size_t i = 0; i < structurals.size(); ++i) {
+        size_t at = structurals[i];
+        char c = json[at];
+
+        switch (expect) {
+            case Expect::End:
+                return ParseOutcome::failure(Kind::Malformed, at);
+            case Expect::Colon:
+                if (c != ':') return ParseOutcome::failure(Kind::Malformed, at);
+                expect = Expect::Value;
+                continue;
+            case Expect::Key:
+            case Expect::KeyOrClose:
+                if (c == '}' && expect == Expect::KeyOrClose) break;
+                if (c != '"') return ParseOutcome::failure(Kind::Malformed, at);
+                if (ParseOutcome outcome = handler.key(i); !outcome.ok()) return outcome;
+                expect = Expect::Colon;
+                continue;
+            case Expect::CommaOrClose:
+                if (c == ',') {
+                    expect = open.back() == '{' ? Expect::Key : Expect::Value;
+                    continue;
+                }
+                if ((c == '}' && open.back() == '{') || (c == ']' && open.back() == '[')) break;
+                return ParseOutcome::failure(Kind::Malformed, at);
+            case Expect::Value:
+            case Expect::ValueOrClose:
+                if (c == ']' && expect == Expect::ValueOrClose) break;
+                if (c == '{' || c == '[') {
+                    handler.open(c);
+                    open.push_back(c);
+                    expect = c == '{' ? Expect::KeyOrClose : Expect::ValueOrClose;
+                    continue;
+                }
+                if (c == '"') {
+                    if (ParseOutcome outcome = handler.string(i); !outcome.ok()) return outcome;
+                } else if (c == '}' || c == ']' || c == ':' || c == ',' || !handler.scalar(i)) {
+                    return ParseOutcome::failure(Kind::Malformed, at);
+                }
+                expect = open.empty() ? Expect::End : Expect::CommaOrClose;
+                continue;
+        }
+
+        // A container just closed, which ends a value
+        handler.close(c);
+        open.pop_back();
+        expect = open.empty() ? Expect::End : Expect::CommaOrClose;
+    }
+
+    if (!strings_closed || expect != Expect::End) return ParseOutcome::failure(Kind::Truncated, json.size());
+    return ParseOutcome::success();
+}
+
+// Why json fails to parse. Returns success() when nothing is wrong with it as
+// far as these checks can tell (the caller then records Rejected).
+inline ParseOutcome diagnose(std::string_view json, std::span<const FieldSpec> schema = {}) {
+    using Kind = ParseErrorKind;
+
+    size_t first = 0;
+    while (first < json.size() && (json[first] == ' ' || json[first] == '\t' || json[first] == '\n' || json[first] == '\r')) {
+        ++first;
+    }
+    if (first == json.size()) return ParseOutcome::failure(Kind::Empty, 0);
+
+    size_t bad_byte = Utf8::firstInvalid(json);
+    if (bad_byte != json.size()) return ParseOutcome::failure(Kind::InvalidUtf8, bad_byte);
+
+    thread_local std::vector<uint32_t> structurals;
+    bool strings_closed = StructuralIndex::build(json, structurals);
+
+    // Grammar only: strings are not decoded, scalars go through validScalar
+    struct Checker {
+        std::string_view json;
+        const std::vector<uint32_t>& structurals;
+
+        ParseOutcome key(size_t) { return ParseOutcome::success(); }
+        ParseOutcome string(size_t) { return ParseOutcome::success(); }
+        bool scalar(size_t i) { return detail::validScalar(StructuralIndex::scalarAt(json, structurals, i)); }
+        void open(char) {}
+        void close(char) {}
+    };
+
+    thread_local std::vector<char> open;
+    Checker checker{ json, structurals };
+    ParseOutcome outcome = walkGrammar(json, structurals, strings_closed, open, checker);
+    if (!outcome.ok()) return outcome;
+    if (schema.empty() || json[structurals[0]] != '{') return ParseOutcome::success();
+
+    // Well-formed: compare the top-level fields with the schema
+    thread_local std::vector<bool> seen;
+    seen.assign(schema.size(), false);
+
+    size_t depth = 0;
+    for (size_t i = 0; i < structurals.size(); ++i) {
+        char c = json[structurals[i]];
+        if (c == '{' || c == '[') { ++depth; continue; }
+        if (c == '}' || c == ']') { --depth; continue; }
+        if (depth != 1 || c != '"' || json[structurals[i + 1]] != ':') continue;
+
+        std::string_view key;
+        StructuralIndex::stringAt(json, structurals, i, key);     // the walk already found its closing quote
+
+        size_t field = 0;
+        while (field < schema.size() && schema[field].name != key) ++field;
+        if (field == schema.size()) return ParseOutcome::failure(Kind::UnknownKey, structurals[i]);
+        seen[field] = true;
+
+        size_t value_at = structurals[i + 2];
+        if (detail::valueType(json[value_at]) != schema[field].type) {
+            return ParseOutcome::failure(Kind::WrongType, value_at);
+        }
+    }
+
+    for (size_t field = 0; field < schema.size(); ++field) {
+        if (schema[field].required && !seen[field]) return ParseOutcome::failure(Kind::MissingField, json.size());
+    }
+    return ParseOutcome::success();
+}
+
+} // namespace ParseResult
+
+#endif // PARSE_OUTCOME_HPP
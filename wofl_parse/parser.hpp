@@ -1,9 +1,53 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
-#include "Tokenizer.hpp"
+#include "tokenizer.hpp"
+#include "reflector.hpp"
+#include "json_number.hpp"
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+namespace ParserDetail {
+
+template<typename T> struct IsVector : std::false_type {};
+template<typename E, typename A> struct IsVector<std::vector<E, A>> : std::true_type {};
+
+template<typename T> struct IsStdArray : std::false_type {};
+template<typename E, size_t N> struct IsStdArray<std::array<E, N>> : std::true_type {};
+
+template<typename T> struct IsOptional : std::false_type {};
+template<typename E> struct IsOptional<std::optional<E>> : std::true_type {};
+
+template<typename T> struct IsStringMap : std::false_type {};
+template<typename V, typename C, typename A> struct IsStringMap<std::map<std::string, V, C, A>> : std::true_type {};
+
+template<typename T> inline constexpr bool unsupported = false;
+
+// Untyped root: any map indexable by key (scalars are stored as their text)
+template<typename T>
+concept KeyIndexed = !Reflected<T> && requires(T& t, const std::string& key) { t[key]; };
+
+} // namespace ParserDetail
+
+// Parses one JSON value from the tokenizer into T.
+//
+// A Reflector-described struct is decoded in place: each field's type picks
+// its decoder at compile time - std::string, bool, numbers, nested reflected
+// structs, std::vector, std::array (exact length), std::optional (null
+// resets it) and std::map<std::string, V>. Unknown keys are skipped.
+//
+// Any other key-indexed map gets the untyped treatment: scalar values are
+// stored as text, nested objects recurse when the map can hold itself, and
+// arrays are skipped.
 template<typename T>
 class Parser {
 public:
@@ -11,29 +55,186 @@ public:
 
     bool parse(T& out) {
         Token t = tokenizer.next();
-        if (t.type != TokenType::ObjectStart) return false;
-        return parseObject(out);
+        if constexpr (ParserDetail::KeyIndexed<T>) {
+            if (t.type != TokenType::ObjectStart) return false;
+            return parseObject(out);
+        } else {
+            return decodeValue(t, out);
+        }
     }
 
 private:
     Tokenizer& tokenizer;
 
-    bool parseObject(T& out) {
+    // 🧩 Typed decoding
+
+    template<typename V>
+    bool decodeValue(Token& token, V& out) {
+        using namespace ParserDetail;
+
+        if constexpr (std::is_same_v<V, std::string>) {
+            if (token.type != TokenType::String) return false;
+            out.assign(token.value);
+            return true;
+        } else if constexpr (std::is_same_v<V, bool>) {
+            if (token.type != TokenType::True && token.type != TokenType::False) return false;
+            out = token.type == TokenType::True;
+            return true;
+        } else if constexpr (std::is_arithmetic_v<V>) {
+            if (token.type != TokenType::Number || !JsonNumber::isNumber(token.value)) return false;
+            const char* first = token.value.data();
+            const char* last = first + token.value.size();
+            auto [end, error] = std::from_chars(first, last, out);
+            return error == std::errc{} && end == last;
+        } else if constexpr (IsOptional<V>::value) {
+            if (token.type == TokenType::Null) {
+                out.reset();
+                return true;
+            }
+            return decodeValue(token, out.emplace());
+        } else if constexpr (Reflected<V>) {
+            if (token.type != TokenType::ObjectStart) return false;
+            return decodeFields(out);
+        } else if constexpr (IsVector<V>::value) {
+            if (token.type != TokenType::ArrayStart) return false;
+            out.clear();
+            if constexpr (std::is_same_v<typename V::value_type, bool>) {
+                // vector<bool> hands out proxies, not bool&
+                return decodeElements([&](Token& element) {
+                    bool value = false;
+                    if (!decodeValue(element, value)) return false;
+                    out.push_back(value);
+                    return true;
+                });
+            } else {
+                return decodeElements([&](Token& element) { return decodeValue(element, out.emplace_back()); });
+            }
+        } else if constexpr (IsStdArray<V>::value) {
+            if (token.type != TokenType::ArrayStart) return false;
+            size_t count = 0;
+            bool ok = decodeElements([&](Token& element) {
+                return count < out.size() && decodeValue(element, out[count++]);
+            });
+            return ok && count == out.size();
+        } else if constexpr (IsStringMap<V>::value) {
+            if (token.type != TokenType::ObjectStart) return false;
+            out.clear();
+            return decodeMembers([&](std::string_view key, Token& value) { return decodeValue(value, out[std::string(key)]); });
+        } else {
+            static_assert(unsupported<V>, "Parser: no JSON mapping for this member type");
+            return false;
+        }
+    }
+
+    // Fields of a reflected struct, written straight into its members
+    template<typename V>
+    bool decodeFields(V& out) {
+        return decodeMembers([&](std::string_view key, Token& value) {
+            bool matched = false;
+            bool ok = true;
+            auto try_field = [&](const auto& field) {
+                if (matched || key != field.first) return;
+                matched = true;
+                ok = decodeValue(value, out.*(field.second));
+            };
+            std::apply([&](const auto&... field) { (try_field(field), ...); }, Reflector<V>::fields);
+            return matched ? ok : skipValue(value);
+        });
+    }
+
+    // Walks "key": value pairs after a consumed '{'; on_member(key, value token)
+    template<typename OnMember>
+    bool decodeMembers(OnMember&& on_member) {
+        Token key = tokenizer.next();
+        if (key.type == TokenType::ObjectEnd) return true;
+
         while (true) {
-            Token key = tokenizer.next();
-            if (key.type == TokenType::ObjectEnd) break;
+            if (key.type != TokenType::String) return false;
+            if (tokenizer.next().type != TokenType::Colon) return false;
+
             Token value = tokenizer.next();
+            if (!on_member(key.value, value)) return false;
+
+            Token next = tokenizer.next();
+            if (next.type == TokenType::ObjectEnd) return true;
+            if (next.type != TokenType::Comma) return false;
+            key = tokenizer.next();
+        }
+    }
+
+    // Walks the elements after a consumed '['; on_element(first token of the element)
+    template<typename OnElement>
+    bool decodeElements(OnElement&& on_element) {
+        Token element = tokenizer.next();
+        if (element.type == TokenType::ArrayEnd) return true;
+
+        while (true) {
+            if (!on_element(element)) return false;
+
+            Token next = tokenizer.next();
+            if (next.type == TokenType::ArrayEnd) return true;
+            if (next.type != TokenType::Comma) return false;
+            element = tokenizer.next();
+        }
+    }
 
-            if (value.type == TokenType::String) {
-                out[key.value] = value.value;
-            } else if (value.type == TokenType::ObjectStart) {
-                T child;
-                if (parseObject(child)) {
-                    out[key.value] = child;
-                }
+    bool skipValue(const Token& token) {
+        switch (token.type) {
+            case TokenType::String:
+            case TokenType::Number:
+            case TokenType::True:
+            case TokenType::False:
+            case TokenType::Null:
+                return true;
+            case TokenType::ObjectStart:
+            case TokenType::ArrayStart:
+                return tokenizer.skipContainer();
+            default:
+                return false;
+        }
+    }
+
+    // 🗺️ Untyped maps
+
+    bool parseObject(T& out) {
+        Token key = tokenizer.next();
+        if (key.type == TokenType::ObjectEnd) return true;
+
+        while (true) {
+            if (key.type != TokenType::String) return false;
+            if (tokenizer.next().type != TokenType::Colon) return false;
+
+            std::string name(key.value);
+            Token value = tokenizer.next();
+            switch (value.type) {
+                case TokenType::String:
+                case TokenType::Number:
+                case TokenType::True:
+                case TokenType::False:
+                case TokenType::Null:
+                    out[name] = value.value;
+                    break;
+                case TokenType::ObjectStart:
+                    if constexpr (std::is_assignable_v<decltype(out[name]), T>) {
+                        T child;
+                        if (!parseObject(child)) return false;
+                        out[name] = std::move(child);
+                    } else if (!tokenizer.skipContainer()) {
+                        return false;
+                    }
+                    break;
+                case TokenType::ArrayStart:
+                    if (!tokenizer.skipContainer()) return false;
+                    break;
+                default:
+                    return false;
             }
+
+            Token next = tokenizer.next();
+            if (next.type == TokenType::ObjectEnd) return true;
+            if (next.type != TokenType::Comma) return false;
+            key = tokenizer.next();
         }
-        return true;
     }
 };
 
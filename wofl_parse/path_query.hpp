@@ -0,0 +1,280 @@
+#ifndef PATH_QUERY_HPP
+#define PATH_QUERY_HPP
+
+// 🧭 Compile-time JSON path queries
+// For consumers that want two or three values out of a large document:
+//
+//   PathQuery::Query<"status", "metadata/region", "data_sets/0/enabled"> query;
+//   std::string_view region;
+//   if (query.run(json) && query.get<"metadata/region">(region)) { ... }
+//
+// Paths are split into segments at compile time ('/'-separated; an
+// all-digit segment also matches that position of an array), and the key
+// comparisons are unrolled per path. run() first builds the structural
+// index of the whole input (validating UTF-8 on the way) - one vectorized
+// pass - and then walks it: a subtree no path leads into is jumped over by
+// bracket counting, nothing in it is decoded or checked, and the walk stops
+// the moment every path has been found. Structure past that point is not
+// checked either, so a document malformed only there still succeeds.
+//
+// Values are views into the input (strings without their quotes, escapes
+// as on the wire; containers as their raw text), and keys are matched as
+// they appear on the wire. The buffer passed to run() must outlive them. A
+// Query is meant to be reused across documents.
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_number.hpp"
+#include "structural_index.hpp"
+
+namespace PathQuery {
+
+// A path as a template argument: Query<"a/b">
+template <size_t N>
+struct Path {
+    char text[N]{};
+
+    constexpr Path(const char (&path)[N]) {
+        for (size_t i = 0; i < N; ++i) text[i] = path[i];
+    }
+
+    constexpr std::string_view view() const { return { text, N - 1 }; }
+};
+
+template <Path... Paths>
+class Query {
+public:
+    static constexpr size_t count = sizeof...(Paths);
+    static_assert(count > 0 && count <= 64, "PathQuery::Query takes 1 to 64 paths");
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    static constexpr size_t segmentCount(std::string_view path) {
+        size_t segments = 1;
+        for (char c : path) segments += c == '/';
+        return segments;
+    }
+
+    static constexpr size_t max_segments = std::max({ segmentCount(Paths.view())... });
+
+    // 📐 Segments of every path, and the array position an all-digit segment names
+    struct Table {
+        std::array<std::array<std::string_view, max_segments>, count> segments{};
+        std::array<std::array<size_t, max_segments>, count> positions{};
+        std::array<size_t, count> depth{};
+    };
+
+    static constexpr Table table = [] {
+        Table t{};
+        std::array<std::string_view, count> paths{ Paths.view()... };
+        for (size_t p = 0; p < count; ++p) {
+            std::string_view rest = paths[p];
+            size_t level = 0;
+            while (true) {
+                size_t slash = rest.find('/');
+                std::string_view segment = rest.substr(0, slash);
+                t.segments[p][level] = segment;
+
+                size_t position = segment.empty() ? npos : 0;
+                for (char c : segment) {
+                    if (c < '0' || c > '9') {
+                        position = npos;
+                        break;
+                    }
+                    position = position * 10 + static_cast<size_t>(c - '0');
+                }
+                t.positions[p][level] = position;
+
+                ++level;
+                if (slash == std::string_view::npos) break;
+                rest = rest.substr(slash + 1);
+            }
+            t.depth[p] = level;
+        }
+        return t;
+    }();
+
+    static constexpr bool noEmptySegments() {
+        for (size_t p = 0; p < count; ++p) {
+            for (size_t level = 0; level < table.depth[p]; ++level) {
+                if (table.segments[p][level].empty()) return false;
+            }
+        }
+        return true;
+    }
+    static_assert(noEmptySegments(), "PathQuery: paths may not be empty or contain empty segments");
+
+    std::string_view json;
+    std::vector<uint32_t> structurals;
+    std::array<std::string_view, count> values{};
+    std::array<char, count> kinds{};           // first byte of each found value, 0 = not found
+    size_t remaining = 0;
+
+    char at(size_t index) const { return json[structurals[index]]; }
+
+    // Index of the structural just past the value at index, npos if it never closes
+    size_t skipValue(size_t index) const {
+        size_t after = 0;
+        return StructuralIndex::skipValue(json, structurals, index, after) ? after : npos;
+    }
+
+    bool record(size_t path, size_t index) {
+        if (kinds[path] != 0) return true;     // duplicate key: first one wins
+
+        char c = at(index);
+        std::string_view text;
+        if (c == '"') {
+            if (!StructuralIndex::stringAt(json, structurals, index, text)) return false;
+        } else if (c == '{' || c == '[') {
+            size_t after = skipValue(index);
+            if (after == npos) return false;
+            size_t close = structurals[after - 1];
+            text = json.substr(structurals[index], close + 1 - structurals[index]);
+        } else {
+            text = StructuralIndex::scalarAt(json, structurals, index);
+        }
+
+        values[path] = text;
+        kinds[path] = c;
+        --remaining;
+        return true;
+    }
+
+    // 🔁 Unrolled per path: does this key (or array position) continue path I?
+    template <size_t I>
+    bool matchOne(std::string_view key, size_t position, uint64_t mask, size_t level, size_t value, uint64_t& deeper) {
+        constexpr uint64_t bit = uint64_t{ 1 } << I;
+        if (!(mask & bit)) return true;
+
+        bool matches = position == npos ? table.segments[I][level] == key : table.positions[I][level] == position;
+        if (!matches) return true;
+        if (level + 1 == table.depth[I]) return record(I, value);
+        deeper |= bit;
+        return true;
+    }
+
+    template <size_t... I>
+    bool match(std::index_sequence<I...>, std::string_view key, size_t position, uint64_t mask, size_t level,
+               size_t value, uint64_t& deeper) {
+        return (matchOne<I>(key, position, mask, level, value, deeper) && ...);
+    }
+
+    // Value of a key or array element: descend if a path continues into it, else skip it
+    size_t visit(std::string_view key, size_t position, uint64_t mask, size_t level, size_t value) {
+        uint64_t deeper = 0;
+        if (!match(std::make_index_sequence<count>{}, key, position, mask, level, value, deeper)) return npos;
+        if (remaining == 0) return npos;
+
+        char c = at(value);
+        if (c == ',' || c == ':' || c == '}' || c == ']') return npos;
+        if (deeper && (c == '{' || c == '[')) return scanContainer(value, deeper, level + 1);
+        return skipValue(value);
+    }
+
+    // Scans the container at index for the paths in mask, whose first level
+    // segments already matched. Returns the index just past it, or npos when
+    // the input is malformed or every path has been found.
+    size_t scanContainer(size_t index, uint64_t mask, size_t level) {
+        bool object = at(index) == '{';
+        char close = object ? '}' : ']';
+        size_t i = index + 1;
+        if (i < structurals.size() && at(i) == close) return i + 1;
+
+        for (size_t position = 0; ; ++position) {
+            size_t after = npos;
+            if (object) {
+                std::string_view key;
+                if (i + 2 >= structurals.size() || at(i) != '"' || at(i + 1) != ':') return npos;
+                if (!StructuralIndex::stringAt(json, structurals, i, key)) return npos;
+                after = visit(key, npos, mask, level, i + 2);
+            } else {
+                if (i >= structurals.size()) return npos;
+                after = visit({}, position, mask, level, i);
+            }
+
+            if (after == npos || after >= structurals.size()) return npos;
+            if (at(after) == close) return after + 1;
+            if (at(after) != ',') return npos;
+            i = after + 1;
+        }
+    }
+
+public:
+    // Index of a path within this query, for found()/raw()
+    template <Path P>
+    static constexpr size_t indexOf() {
+        constexpr std::array<std::string_view, count> paths{ Paths.view()... };
+        for (size_t i = 0; i < count; ++i) {
+            if (paths[i] == P.view()) return i;
+        }
+        return count;
+    }
+
+    // Looks for every path in json. False when the input is not valid UTF-8
+    // or turns out to be malformed before all paths were found; paths that
+    // are simply absent are not an error (found() says which ones were).
+    bool run(std::string_view input) {
+        json = input;
+        values = {};
+        kinds = {};
+        remaining = count;
+
+        bool utf8_valid = true;
+        StructuralIndex::buildValidated(json, structurals, utf8_valid);
+        if (!utf8_valid || structurals.empty()) return false;
+
+        char root = at(0);
+        if (root != '{' && root != '[') return structurals.size() == 1;
+
+        constexpr uint64_t all = count == 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << count) - 1;
+        size_t end = scanContainer(0, all, 0);
+        return remaining == 0 || end == structurals.size();
+    }
+
+    bool found(size_t path) const { return kinds[path] != 0; }
+    size_t foundCount() const { return count - remaining; }
+
+    // Raw text of a found value (string contents without quotes)
+    std::string_view raw(size_t path) const { return values[path]; }
+
+    // Typed access by path; false if the path was not found or holds another type
+    template <Path P, typename T>
+    bool get(T& out) const {
+        constexpr size_t path = indexOf<P>();
+        static_assert(path < count, "PathQuery: this path is not part of the query");
+
+        std::string_view text = values[path];
+        char kind = kinds[path];
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            if (kind != '"') return false;
+            out = text;
+            return true;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            if (text == "true") out = true;
+            else if (text == "false") out = false;
+            else return false;
+            return true;
+        } else {
+            static_assert(std::is_arithmetic_v<T>, "PathQuery::get: T must be std::string_view, bool or a number");
+            if (kind == '"' || !JsonNumber::isNumber(text)) return false;
+            T value{};
+            auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (error != std::errc{} || end != text.data() + text.size()) return false;
+            out = value;
+            return true;
+        }
+    }
+};
+
+} // namespace PathQuery
+
+#endif // PATH_QUERY_HPP
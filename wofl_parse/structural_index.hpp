@@ -0,0 +1,348 @@
+#ifndef STRUCTURAL_INDEX_HPP
+#define STRUCTURAL_INDEX_HPP
+
+// 🧭 Stage-1 structural indexer (simdjson-style)
+// Classifies the input 64 bytes at a time into bitmasks (quotes, backslashes,
+// whitespace, operators), resolves escaped quotes and string interiors with
+// bit arithmetic, and emits the byte offset of every structural character:
+// { } [ ] : , plus the first byte of every string, number and literal.
+// The tokenizer then jumps from offset to offset instead of walking bytes.
+//
+// Kernels: AVX2 + PCLMUL, SSE2, and a portable scalar one. The kernel follows
+// CpuDispatch::activeIsa(), so the AVX2 path is used even when the build does
+// not pass -mavx2. Offsets are 32-bit (inputs < 4 GiB).
+//
+// buildValidated() also checks the input is UTF-8; on AVX2 the check runs on
+// the registers the indexer already loaded, so it adds no extra pass.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "cpu_dispatch.hpp"
+#include "utf8_validate.hpp"
+
+namespace StructuralIndex {
+
+enum class Kernel {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+inline const char* kernelName(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::Avx2: return "AVX2";
+        case Kernel::Sse2: return "SSE2";
+        default: return "scalar";
+    }
+}
+
+namespace detail {
+
+struct BlockMasks {
+    uint64_t backslash{ 0 };
+    uint64_t quote{ 0 };
+    uint64_t whitespace{ 0 };
+    uint64_t op{ 0 };              // { } [ ] : ,
+};
+
+// Carries between blocks
+struct ScanState {
+    uint64_t prev_escaped{ 0 };
+    uint64_t prev_in_string{ 0 };  // all ones while a string is open
+    uint64_t prev_scalar{ 0 };
+};
+
+inline uint64_t prefixXorScalar(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+// Bits escaped by an odd-length backslash run (the run may start in an earlier block)
+inline uint64_t findEscaped(uint64_t backslash, uint64_t& prev_escaped) {
+    constexpr uint64_t even_bits = 0x5555555555555555ULL;
+
+    backslash &= ~prev_escaped;
+    uint64_t follows_escape = (backslash << 1) | prev_escaped;
+    uint64_t odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+    uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+    prev_escaped = sequences_starting_on_even_bits < odd_sequence_starts;
+    uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+    return (even_bits ^ invert_mask) & follows_escape;
+}
+
+// Turns one block's masks into structural starts and appends their offsets.
+// quote_prefix is prefix_xor(unescaped quotes), supplied by the kernel so the
+// AVX2 path can use carry-less multiply for it.
+template <typename PrefixXor>
+inline void finishBlock(BlockMasks masks, ScanState& state, PrefixXor prefix_xor,
+                        uint32_t base, std::vector<uint32_t>& out) {
+    uint64_t escaped = findEscaped(masks.backslash, state.prev_escaped);
+    uint64_t quote = masks.quote & ~escaped;
+
+    // Opening quote through the byte before the closing quote
+    uint64_t in_string = prefix_xor(quote) ^ state.prev_in_string;
+    state.prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    uint64_t string_tail = in_string ^ quote;
+
+    uint64_t scalar = ~(masks.op | masks.whitespace);
+    uint64_t nonquote_scalar = scalar & ~quote;
+    uint64_t follows_nonquote_scalar = (nonquote_scalar << 1) | state.prev_scalar;
+    state.prev_scalar = nonquote_scalar >> 63;
+
+    uint64_t structurals = (masks.op | (scalar & ~follows_nonquote_scalar)) & ~string_tail;
+    while (structurals) {
+        out.push_back(base + static_cast<uint32_t>(std::countr_zero(structurals)));
+        structurals &= structurals - 1;
+    }
+}
+
+// Final partial block, padded with spaces so it classifies as whitespace
+struct PaddedTail {
+    alignas(64) char bytes[64];
+
+    PaddedTail(const char* data, size_t length) {
+        std::memset(bytes, ' ', sizeof(bytes));
+        std::memcpy(bytes, data, length);
+    }
+};
+
+// 🐢 Portable kernel
+inline void classifyScalar(const char* block, BlockMasks& masks) {
+    masks = {};
+    for (size_t i = 0; i < 64; ++i) {
+        uint64_t bit = uint64_t{ 1 } << i;
+        switch (block[i]) {
+            case '\\': masks.backslash |= bit; break;
+            case '"': masks.quote |= bit; break;
+            case ' ': case '\t': case '\n': case '\r': masks.whitespace |= bit; break;
+            case '{': case '}': case '[': case ']': case ':': case ',': masks.op |= bit; break;
+            default: break;
+        }
+    }
+}
+
+inline bool scanScalar(std::string_view input, std::vector<uint32_t>& out) {
+    ScanState state{};
+    BlockMasks masks{};
+    size_t base = 0;
+    for (; base + 64 <= input.size(); base += 64) {
+        classifyScalar(input.data() + base, masks);
+        finishBlock(masks, state, prefixXorScalar, static_cast<uint32_t>(base), out);
+    }
+    if (base < input.size()) {
+        PaddedTail tail(input.data() + base, input.size() - base);
+        classifyScalar(tail.bytes, masks);
+        finishBlock(masks, state, prefixXorScalar, static_cast<uint32_t>(base), out);
+    }
+    return state.prev_in_string == 0;
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// ⚡ SSE2 kernel (x86-64 baseline): four 16-byte lanes per block
+inline uint64_t matchSse2(const __m128i lanes[4], char c) {
+    __m128i needle = _mm_set1_epi8(c);
+    uint64_t bits = 0;
+    for (int i = 0; i < 4; ++i) {
+        bits |= static_cast<uint64_t>(static_cast<uint16_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(lanes[i], needle)))) << (16 * i);
+    }
+    return bits;
+}
+
+inline void classifySse2(const char* block, BlockMasks& masks) {
+    __m128i lanes[4];
+    for (int i = 0; i < 4; ++i) {
+        lanes[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+    }
+    masks.backslash = matchSse2(lanes, '\\');
+    masks.quote = matchSse2(lanes, '"');
+    masks.whitespace = matchSse2(lanes, ' ') | matchSse2(lanes, '\t')
+                     | matchSse2(lanes, '\n') | matchSse2(lanes, '\r');
+    masks.op = matchSse2(lanes, '{') | matchSse2(lanes, '}') | matchSse2(lanes, '[')
+             | matchSse2(lanes, ']') | matchSse2(lanes, ':') | matchSse2(lanes, ',');
+}
+
+inline bool scanSse2(std::string_view input, std::vector<uint32_t>& out) {
+    ScanState state{};
+    BlockMasks masks{};
+    size_t base = 0;
+    for (; base + 64 <= input.size(); base += 64) {
+        classifySse2(input.data() + base, masks);
+        finishBlock(masks, state, prefixXorScalar, static_cast<uint32_t>(base), out);
+    }
+    if (base < input.size()) {
+        PaddedTail tail(input.data() + base, input.size() - base);
+        classifySse2(tail.bytes, masks);
+        finishBlock(masks, state, prefixXorScalar, static_cast<uint32_t>(base), out);
+    }
+    return state.prev_in_string == 0;
+}
+
+// 🚀 AVX2 kernel: two 32-byte lanes per block, prefix XOR via carry-less multiply
+CPU_DISPATCH_TARGET_AVX2 inline uint64_t matchAvx2(__m256i low, __m256i high, char c) {
+    __m256i needle = _mm256_set1_epi8(c);
+    uint64_t low_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+    uint64_t high_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+    return low_bits | (high_bits << 32);
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline void classifyAvx2(__m256i low, __m256i high, BlockMasks& masks) {
+    masks.backslash = matchAvx2(low, high, '\\');
+    masks.quote = matchAvx2(low, high, '"');
+    masks.whitespace = matchAvx2(low, high, ' ') | matchAvx2(low, high, '\t')
+                     | matchAvx2(low, high, '\n') | matchAvx2(low, high, '\r');
+    masks.op = matchAvx2(low, high, '{') | matchAvx2(low, high, '}') | matchAvx2(low, high, '[')
+             | matchAvx2(low, high, ']') | matchAvx2(low, high, ':') | matchAvx2(low, high, ',');
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline uint64_t prefixXorClmul(uint64_t bits) {
+    __m128i all_ones = _mm_set1_epi8(static_cast<char>(0xFF));
+    __m128i result = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(bits)), all_ones, 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(result));
+}
+
+// With Validate, the UTF-8 check runs on the lanes classifyAvx2 just used
+template <bool Validate>
+CPU_DISPATCH_TARGET_AVX2 inline void scanBlockAvx2(const char* block, BlockMasks& masks, Utf8::detail::Avx2State& utf8) {
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+    classifyAvx2(low, high, masks);
+    if constexpr (Validate) Utf8::detail::avx2CheckBlock(utf8, low, high);
+}
+
+template <bool Validate>
+CPU_DISPATCH_TARGET_AVX2 inline bool scanAvx2Impl(std::string_view input, std::vector<uint32_t>& out, bool& utf8_valid) {
+    ScanState state{};
+    BlockMasks masks{};
+    Utf8::detail::Avx2State utf8;
+    Utf8::detail::avx2Begin(utf8);
+
+    size_t base = 0;
+    for (; base + 64 <= input.size(); base += 64) {
+        scanBlockAvx2<Validate>(input.data() + base, masks, utf8);
+        finishBlock(masks, state, prefixXorClmul, static_cast<uint32_t>(base), out);
+    }
+    if (base < input.size()) {
+        PaddedTail tail(input.data() + base, input.size() - base);
+        scanBlockAvx2<Validate>(tail.bytes, masks, utf8);
+        finishBlock(masks, state, prefixXorClmul, static_cast<uint32_t>(base), out);
+    }
+    if constexpr (Validate) utf8_valid = Utf8::detail::avx2Finish(utf8);
+    return state.prev_in_string == 0;
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline bool scanAvx2(std::string_view input, std::vector<uint32_t>& out) {
+    bool unused = true;
+    return scanAvx2Impl<false>(input, out, unused);
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline bool scanValidatedAvx2(std::string_view input, std::vector<uint32_t>& out, bool& utf8_valid) {
+    return scanAvx2Impl<true>(input, out, utf8_valid);
+}
+
+#endif // CPU_DISPATCH_X86
+
+} // namespace detail
+
+// AVX-512 hosts use the AVX2 kernel
+inline Kernel activeKernel() {
+    switch (CpuDispatch::activeIsa()) {
+        case CpuDispatch::Isa::Avx512:
+        case CpuDispatch::Isa::Avx2: return Kernel::Avx2;
+        case CpuDispatch::Isa::Sse2: return Kernel::Sse2;
+        default: return Kernel::Scalar;
+    }
+}
+
+// Replaces out with the structural offsets of input. Returns false when the
+// input ends inside a string; the offsets up to that point are still valid.
+inline bool build(std::string_view input, std::vector<uint32_t>& out, Kernel kernel = activeKernel()) {
+    out.clear();
+    out.reserve(input.size() / 4 + 8);
+
+    #ifdef CPU_DISPATCH_X86
+        if (kernel == Kernel::Avx2) return detail::scanAvx2(input, out);
+        if (kernel == Kernel::Sse2) return detail::scanSse2(input, out);
+    #endif
+    return detail::scanScalar(input, out);
+}
+
+// build(), and utf8_valid says whether input is well-formed UTF-8. Invalid
+// input still gets indexed; callers are expected to reject it before
+// decoding anything.
+inline bool buildValidated(std::string_view input, std::vector<uint32_t>& out, bool& utf8_valid,
+                           Kernel kernel = activeKernel()) {
+    #ifdef CPU_DISPATCH_X86
+        if (kernel == Kernel::Avx2) {
+            out.clear();
+            out.reserve(input.size() / 4 + 8);
+            return detail::scanValidatedAvx2(input, out, utf8_valid);
+        }
+    #endif
+    utf8_valid = Utf8::detail::firstInvalidScalar(input) == input.size();
+    return build(input, out, kernel);
+}
+
+// 🔍 Reading values off an index from build(); index is the value's entry in structurals
+
+// Raw contents (escapes intact) of the string whose opening quote is
+// structurals[index]. Only whitespace may sit between the closing quote and
+// the next structural, so the closing quote is the last one before it.
+inline bool stringAt(std::string_view input, const std::vector<uint32_t>& structurals, size_t index,
+                     std::string_view& out) {
+    size_t start = structurals[index] + 1;
+    size_t limit = index + 1 < structurals.size() ? structurals[index + 1] : input.size();
+    size_t close = input.rfind('"', limit - 1);
+    if (close == std::string_view::npos || close < start) return false;
+    out = input.substr(start, close - start);
+    return true;
+}
+
+// Text of a number or literal: up to the next structural, trailing whitespace trimmed
+inline std::string_view scalarAt(std::string_view input, const std::vector<uint32_t>& structurals, size_t index) {
+    size_t start = structurals[index];
+    size_t end = index + 1 < structurals.size() ? structurals[index + 1] : input.size();
+    while (end > start) {
+        char c = input[end - 1];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+        --end;
+    }
+    return input.substr(start, end - start);
+}
+
+// Index of the structural just past the value at index. Containers are
+// bracket-counted, not checked; false when one is never closed.
+inline bool skipValue(std::string_view input, const std::vector<uint32_t>& structurals, size_t index, size_t& after) {
+    char c = input[structurals[index]];
+    if (c != '{' && c != '[') {
+        after = index + 1;
+        return true;
+    }
+
+    size_t depth = 0;
+    for (size_t i = index; i < structurals.size(); ++i) {
+        char s = input[structurals[i]];
+        if (s == '{' || s == '[') {
+            ++depth;
+        } else if ((s == '}' || s == ']') && --depth == 0) {
+            after = i + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace StructuralIndex
+
+#endif // STRUCTURAL_INDEX_HPP
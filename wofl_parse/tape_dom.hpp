@@ -0,0 +1,402 @@
+#ifndef TAPE_DOM_HPP
+#define TAPE_DOM_HPP
+
+// 📼 Tape DOM for payloads whose schema we don't know
+// A parsed document is one flat array of 64-bit entries (the tape) plus one
+// byte arena holding every string, unescaped. Each entry is a tag in the top
+// byte and a payload in the low 56 bits:
+//
+//   {  [    index just past the matching close (low 32), child count (next 24)
+//   }  ]    index of the matching open
+//   "       offset of the string in the arena: [u32 length][bytes][NUL]
+//   l  d    int64 / double; the value is the following entry
+//   t  f  n true / false / null
+//
+// Skipping a nested object or array is one read, so key lookup walks only
+// the fields of the object it searches. A Document keeps its tape, arena
+// and scratch vectors between load() calls: once they have grown to the
+// largest packet seen, parsing allocates nothing.
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "structural_index.hpp"
+#include "utf8_validate.hpp"
+#include "parse_outcome.hpp"
+#include "json_number.hpp"
+#include "json_string.hpp"
+
+namespace TapeDom {
+
+enum class Type : uint8_t {
+    Object,
+    Array,
+    String,
+    Int64,
+    Double,
+    Bool,
+    Null
+};
+
+namespace detail {
+
+enum Tag : uint8_t {
+    ObjectStart = '{',
+    ObjectEnd = '}',
+    ArrayStart = '[',
+    ArrayEnd = ']',
+    String = '"',
+    Int64 = 'l',
+    Double = 'd',
+    True = 't',
+    False = 'f',
+    Null = 'n'
+};
+
+constexpr uint64_t payload_mask = (uint64_t{ 1 } << 56) - 1;
+constexpr uint64_t max_child_count = (uint64_t{ 1 } << 24) - 1;
+
+inline uint64_t entry(Tag tag, uint64_t payload) { return (uint64_t{ tag } << 56) | payload; }
+inline Tag tagOf(uint64_t word) { return static_cast<Tag>(word >> 56); }
+inline uint64_t payloadOf(uint64_t word) { return word & payload_mask; }
+
+} // namespace detail
+
+class Document;
+
+// 🔎 A view of one value on a Document's tape. A default-constructed
+// Element stands for "not there" (a missing key, an index out of range).
+class Element {
+private:
+    const Document* doc = nullptr;
+    uint32_t index = 0;
+
+    uint64_t word() const;
+    uint64_t next() const;
+
+public:
+    Element() = default;
+    Element(const Document* document, uint32_t tape_index) : doc(document), index(tape_index) {}
+
+    bool exists() const { return doc != nullptr; }
+    Type type() const;
+
+    bool isObject() const { return exists() && type() == Type::Object; }
+    bool isArray() const { return exists() && type() == Type::Array; }
+
+    // Accessors return false when the element is missing or of another type
+    bool getString(std::string_view& out) const;
+    bool getInt64(int64_t& out) const;
+    bool getDouble(double& out) const;        // integers convert
+    bool getBool(bool& out) const;
+    bool isNull() const { return exists() && type() == Type::Null; }
+
+    // Fields of an object / elements of an array (saturates at 2^24 - 1)
+    size_t size() const;
+
+    // Object field by key (first match), or a missing Element
+    Element operator[](std::string_view key) const;
+
+    // Array element by position, or a missing Element
+    Element at(size_t position) const;
+
+    // f(std::string_view key, Element value) for each field, in document order
+    template <typename F>
+    void forEachField(F&& f) const;
+
+    // f(Element value) for each array element
+    template <typename F>
+    void forEachElement(F&& f) const;
+
+    // Tape index just past this value
+    uint32_t after() const;
+};
+
+class Document {
+private:
+    friend class Element;
+
+    std::vector<uint64_t> tape;
+    std::vector<char> strings;
+    std::vector<uint32_t> structurals;
+    std::vector<uint32_t> open_containers;    // tape indexes of unclosed { and [
+    std::vector<char> open_kinds;             // scratch for walkGrammar
+
+    std::string_view stringAt(uint64_t offset) const {
+        uint32_t length;
+        std::memcpy(&length, strings.data() + offset, sizeof(length));
+        return { strings.data() + offset + sizeof(length), length };
+    }
+
+    // Unescapes the string whose opening quote is structurals[index] into the arena
+    bool appendString(std::string_view json, size_t index, size_t& error_offset) {
+        std::string_view raw;
+        if (!StructuralIndex::stringAt(json, structurals, index, raw)) {
+            error_offset = structurals[index];
+            return false;
+        }
+
+        size_t offset = strings.size();
+        strings.resize(offset + sizeof(uint32_t));
+        size_t bad = JsonString::unescapeInto(raw, strings);
+        if (bad != raw.size()) {
+            error_offset = structurals[index] + 1 + bad;
+            return false;
+        }
+
+        uint32_t length = static_cast<uint32_t>(strings.size() - offset - sizeof(uint32_t));
+        std::memcpy(strings.data() + offset, &length, sizeof(length));
+        strings.push_back('\0');
+        tape.push_back(detail::entry(detail::String, offset));
+        return true;
+    }
+
+    // Number or literal running from json[at] up to the next structural
+    bool appendScalar(std::string_view json, size_t index) {
+        std::string_view text = StructuralIndex::scalarAt(json, structurals, index);
+
+        if (text == "true") { tape.push_back(detail::entry(detail::True, 0)); return true; }
+        if (text == "false") { tape.push_back(detail::entry(detail::False, 0)); return true; }
+        if (text == "null") { tape.push_back(detail::entry(detail::Null, 0)); return true; }
+
+        bool integral = false;
+        if (JsonNumber::scan(text, integral) != text.size() || text.empty()) return false;
+
+        const char* first = text.data();
+        const char* last = text.data() + text.size();
+        if (integral) {
+            int64_t value = 0;
+            auto [stop, error] = std::from_chars(first, last, value);
+            if (error == std::errc{} && stop == last) {
+                tape.push_back(detail::entry(detail::Int64, 0));
+                tape.push_back(static_cast<uint64_t>(value));
+                return true;
+            }
+        }
+
+        // Fractions, exponents and integers too big for int64
+        double value = 0.0;
+        auto [stop, error] = std::from_chars(first, last, value);
+        if (error != std::errc{} || stop != last) return false;
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        tape.push_back(detail::entry(detail::Double, 0));
+        tape.push_back(bits);
+        return true;
+    }
+
+    void countChild() {
+        if (open_containers.empty()) return;
+        uint64_t& start = tape[open_containers.back()];
+        if (((start >> 32) & detail::max_child_count) < detail::max_child_count) {
+            start += uint64_t{ 1 } << 32;
+        }
+    }
+
+    void openContainer(detail::Tag tag) {
+        open_containers.push_back(static_cast<uint32_t>(tape.size()));
+        tape.push_back(detail::entry(tag, 0));
+    }
+
+    void closeContainer(detail::Tag tag) {
+        uint32_t start = open_containers.back();
+        open_containers.pop_back();
+        tape.push_back(detail::entry(tag, start));
+        tape[start] |= static_cast<uint32_t>(tape.size());
+    }
+
+    bool insideArray() const {
+        return !open_containers.empty() && detail::tagOf(tape[open_containers.back()]) == detail::ArrayStart;
+    }
+
+public:
+    // Parses json onto the tape. Never throws; on failure the outcome says
+    // what went wrong and where, and the document is empty.
+    ParseResult::ParseOutcome load(std::string_view json) {
+        using ParseResult::ParseErrorKind;
+        using ParseResult::ParseOutcome;
+
+        tape.clear();
+        strings.clear();
+        open_containers.clear();
+
+        auto fail = [this](ParseErrorKind kind, size_t offset) {
+            tape.clear();
+            strings.clear();
+            return ParseOutcome::failure(kind, offset);
+        };
+
+        bool utf8_valid = true;
+        bool strings_closed = StructuralIndex::buildValidated(json, structurals, utf8_valid);
+        if (!utf8_valid) return fail(ParseErrorKind::InvalidUtf8, Utf8::firstInvalid(json));
+        if (structurals.empty()) return fail(ParseErrorKind::Empty, 0);
+
+        // The shared walk checks the grammar; this builds the tape as it goes
+        struct Builder {
+            Document& doc;
+            std::string_view json;
+            bool strings_closed;
+
+            // A string the input ends inside of is its last structural
+            ParseOutcome appendString(size_t i) {
+                size_t error_offset = 0;
+                if (doc.appendString(json, i, error_offset)) return ParseOutcome::success();
+                if (!strings_closed && i + 1 == doc.structurals.size()) {
+                    return ParseOutcome::failure(ParseErrorKind::Truncated, json.size());
+                }
+                return ParseOutcome::failure(ParseErrorKind::Malformed, error_offset);
+            }
+
+            ParseOutcome key(size_t i) {
+                doc.countChild();
+                return appendString(i);
+            }
+            ParseOutcome string(size_t i) {
+                if (doc.insideArray()) doc.countChild();
+                return appendString(i);
+            }
+            bool scalar(size_t i) {
+                if (doc.insideArray()) doc.countChild();
+                return doc.appendScalar(json, i);
+            }
+            void open(char c) {
+                if (doc.insideArray()) doc.countChild();
+                doc.openContainer(c == '{' ? detail::ObjectStart : detail::ArrayStart);
+            }
+            void close(char c) { doc.closeContainer(c == '}' ? detail::ObjectEnd : detail::ArrayEnd); }
+        };
+
+        Builder builder{ *this, json, strings_closed };
+        ParseOutcome outcome = ParseResult::walkGrammar(json, structurals, strings_closed, open_kinds, builder);
+        if (!outcome.ok()) return fail(outcome.kind, outcome.offset);
+        return ParseOutcome::success();
+    }
+
+    // The top-level value; missing if nothing has been loaded
+    Element root() const { return tape.empty() ? Element{} : Element{ this, 0 }; }
+
+    size_t tapeEntries() const { return tape.size(); }
+    size_t stringBytes() const { return strings.size(); }
+};
+
+// 🔎 Element, now that Document is complete
+
+inline uint64_t Element::word() const { return doc->tape[index]; }
+inline uint64_t Element::next() const { return doc->tape[index + 1]; }
+
+inline Type Element::type() const {
+    switch (detail::tagOf(word())) {
+        case detail::ObjectStart: return Type::Object;
+        case detail::ArrayStart: return Type::Array;
+        case detail::String: return Type::String;
+        case detail::Int64: return Type::Int64;
+        case detail::Double: return Type::Double;
+        case detail::True:
+        case detail::False: return Type::Bool;
+        default: return Type::Null;
+    }
+}
+
+inline uint32_t Element::after() const {
+    switch (detail::tagOf(word())) {
+        case detail::ObjectStart:
+        case detail::ArrayStart: return static_cast<uint32_t>(word());
+        case detail::Int64:
+        case detail::Double: return index + 2;
+        default: return index + 1;
+    }
+}
+
+inline bool Element::getString(std::string_view& out) const {
+    if (!exists() || detail::tagOf(word()) != detail::String) return false;
+    out = doc->stringAt(detail::payloadOf(word()));
+    return true;
+}
+
+inline bool Element::getInt64(int64_t& out) const {
+    if (!exists() || detail::tagOf(word()) != detail::Int64) return false;
+    out = static_cast<int64_t>(next());
+    return true;
+}
+
+inline bool Element::getDouble(double& out) const {
+    if (!exists()) return false;
+    detail::Tag tag = detail::tagOf(word());
+    if (tag == detail::Int64) {
+        out = static_cast<double>(static_cast<int64_t>(next()));
+        return true;
+    }
+    if (tag != detail::Double) return false;
+    uint64_t bits = next();
+    std::memcpy(&out, &bits, sizeof(out));
+    return true;
+}
+
+inline bool Element::getBool(bool& out) const {
+    if (!exists()) return false;
+    detail::Tag tag = detail::tagOf(word());
+    if (tag != detail::True && tag != detail::False) return false;
+    out = tag == detail::True;
+    return true;
+}
+
+inline size_t Element::size() const {
+    if (!isObject() && !isArray()) return 0;
+    return static_cast<size_t>((word() >> 32) & detail::max_child_count);
+}
+
+template <typename F>
+void Element::forEachField(F&& f) const {
+    if (!isObject()) return;
+    uint32_t end = after() - 1;     // the closing }
+    uint32_t i = index + 1;
+    while (i < end) {
+        Element value{ doc, i + 1 };
+        f(doc->stringAt(detail::payloadOf(doc->tape[i])), value);
+        i = value.after();
+    }
+}
+
+template <typename F>
+void Element::forEachElement(F&& f) const {
+    if (!isArray()) return;
+    uint32_t end = after() - 1;     // the closing ]
+    uint32_t i = index + 1;
+    while (i < end) {
+        Element value{ doc, i };
+        f(value);
+        i = value.after();
+    }
+}
+
+inline Element Element::operator[](std::string_view key) const {
+    if (!isObject()) return {};
+    uint32_t end = after() - 1;
+    uint32_t i = index + 1;
+    while (i < end) {
+        Element value{ doc, i + 1 };
+        if (doc->stringAt(detail::payloadOf(doc->tape[i])) == key) return value;
+        i = value.after();
+    }
+    return {};
+}
+
+inline Element Element::at(size_t position) const {
+    if (!isArray()) return {};
+    uint32_t end = after() - 1;
+    uint32_t i = index + 1;
+    for (size_t n = 0; i < end; ++n) {
+        Element value{ doc, i };
+        if (n == position) return value;
+        i = value.after();
+    }
+    return {};
+}
+
+} // namespace TapeDom
+
+#endif // TAPE_DOM_HPP
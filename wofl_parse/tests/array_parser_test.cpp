@@ -0,0 +1,170 @@
+// ArrayParser<T>: numbers at the limits of every width, the JSON number
+// grammar, string unescaping, trailing content, and leaving the output as it
+// was when a parse fails
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ArrayParser.hpp"
+#include "check.hpp"
+#include "ondemand.hpp"
+#include "tape_dom.hpp"
+
+namespace {
+
+template <typename T>
+bool parses(std::string_view json, const std::vector<T>& expected) {
+    std::vector<T> out;
+    return ArrayParser<T>(json).parse(out) && out == expected;
+}
+
+template <typename T>
+bool rejects(std::string_view json) {
+    std::vector<T> out;
+    return !ArrayParser<T>(json).parse(out) && out.empty();
+}
+
+void testIntegerLimits() {
+    CHECK(parses<uint64_t>("[18446744073709551615]", { std::numeric_limits<uint64_t>::max() }));
+    CHECK(parses<uint64_t>("[10000000000000000000, 9999999999999999999]",
+                           { 10000000000000000000ULL, 9999999999999999999ULL }));
+    CHECK(rejects<uint64_t>("[18446744073709551616]"));
+    CHECK(rejects<uint64_t>("[99999999999999999999]"));
+    CHECK(rejects<uint64_t>("[100000000000000000000]"));
+    CHECK(rejects<uint64_t>("[-1]"));
+    CHECK(parses<uint64_t>("[-0]", { 0 }));
+
+    CHECK(parses<int64_t>("[9223372036854775807,-9223372036854775808]",
+                          { std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() }));
+    CHECK(rejects<int64_t>("[9223372036854775808]"));
+    CHECK(rejects<int64_t>("[-9223372036854775809]"));
+
+    CHECK(parses<int8_t>("[127,-128]", { 127, -128 }));
+    CHECK(rejects<int8_t>("[128]"));
+    CHECK(rejects<int8_t>("[-129]"));
+    CHECK(parses<uint16_t>("[65535]", { 65535 }));
+    CHECK(rejects<uint16_t>("[65536]"));
+
+    // Runs long enough to go through the eight-digit path
+    CHECK(parses<uint64_t>("[1234567812345678,12345678]", { 1234567812345678ULL, 12345678 }));
+}
+
+void testNumberGrammar() {
+    // Integers
+    CHECK(rejects<int>("[01]"));
+    CHECK(rejects<int>("[-01]"));
+    CHECK(rejects<int>("[+1]"));
+    CHECK(rejects<int>("[-]"));
+    CHECK(rejects<int>("[1.0]"));
+    CHECK(rejects<int>("[1e2]"));
+    CHECK(rejects<int>("[0x1]"));
+    CHECK(parses<int>("[0, -0, 10]", { 0, 0, 10 }));
+
+    // Floating point follows the same grammar
+    CHECK(parses<double>("[0, -0.5, 1.25e2, 2E-1, 3e+0, 12]", { 0.0, -0.5, 125.0, 0.2, 3.0, 12.0 }));
+    const char* bad[] = { "[01]", "[1.]", "[.5]", "[01.5]", "[1.e3]", "[1e]", "[1e+]", "[+1]", "[-]",
+                          "[inf]", "[nan]", "[-.5]", "[1.5.5]", "[1e309]" };
+    for (const char* json : bad) {
+        CHECK(rejects<double>(json));
+        CHECK(rejects<float>(json));
+    }
+    CHECK(rejects<float>("[1e39]"));
+
+    // The tape DOM and the on-demand reader agree with it
+    TapeDom::Document tape;
+    OnDemand::Document on_demand;
+    for (const char* text : { "01", "1.", "1e", "-", "-01" }) {
+        std::string array = std::string("[") + text + "]";
+        std::string object = std::string("{\"n\":") + text + "}";
+        CHECK(!tape.load(array).ok());
+        double value = 0;
+        CHECK(!on_demand.load(object) || !on_demand.getNumber("n", value));
+    }
+}
+
+void testBools() {
+    CHECK(parses<bool>("[true, false ,true]", { true, false, true }));
+    CHECK(rejects<bool>("[tru]"));
+    CHECK(rejects<bool>("[1]"));
+    CHECK(rejects<bool>("[null]"));
+}
+
+void testStrings() {
+    CHECK(parses<std::string>(R"(["a", "", "b c"])", { "a", "", "b c" }));
+    CHECK(parses<std::string>(R"(["a\"b", "c\\d", "\/\b\f\n\r\t", "é", "😀"])",
+                              { "a\"b", "c\\d", "/\b\f\n\r\t", "\xC3\xA9", "\xF0\x9F\x98\x80" }));
+    CHECK(parses<std::string>("[\"caf\xC3\xA9\"]", { "caf\xC3\xA9" }));
+
+    CHECK(rejects<std::string>(R"(["\x"])"));
+    CHECK(rejects<std::string>(R"(["\ud83d"])"));
+    CHECK(rejects<std::string>(R"(["\u12"])"));
+    CHECK(rejects<std::string>("[\"tab\there\"]"));   // raw control character
+    CHECK(rejects<std::string>("[\"caf\xC3\x28\"]")); // invalid UTF-8
+    CHECK(rejects<std::string>(R"(["open)"));
+    CHECK(rejects<std::string>(R"(["a\)"));
+    CHECK(rejects<std::string>(R"([1])"));
+}
+
+void testStructure() {
+    CHECK(parses<int>(" [ 1 , 2 ] \n", { 1, 2 }));
+    CHECK(parses<int>("[]", {}));
+    CHECK(parses<int>(" [ ] ", {}));
+
+    const char* bad[] = { "", "1", "[", "[1", "[1,", "[1,]", "[,1]", "[1 2]", "[[1]]", "[null]", "{}",
+                          "[1]x", "[1] 2", "[1],[2]", "[]]", "[] x" };
+    for (const char* json : bad) {
+        CHECK(rejects<int>(json));
+    }
+}
+
+void testFailureCleanup() {
+    // A failed parse leaves earlier contents alone and adds nothing
+    std::vector<int> numbers{ 7, 8 };
+    CHECK(!ArrayParser<int>("[1,2,3,x]").parse(numbers));
+    CHECK((numbers == std::vector<int>{ 7, 8 }));
+    CHECK(!ArrayParser<int>("[1,2] trailing").parse(numbers));
+    CHECK((numbers == std::vector<int>{ 7, 8 }));
+    CHECK(ArrayParser<int>("[1,2]").parse(numbers));
+    CHECK((numbers == std::vector<int>{ 7, 8, 1, 2 }));
+
+    std::vector<std::string> strings{ "keep" };
+    CHECK(!ArrayParser<std::string>(R"(["a","b","\q"])").parse(strings));
+    CHECK((strings == std::vector<std::string>{ "keep" }));
+
+    // Span output: count is zero after a failure, including running out of room
+    std::array<int, 3> storage{};
+    size_t count = 99;
+    CHECK(ArrayParser<int>("[4,5]").parse(std::span<int>(storage), count) && count == 2);
+    CHECK(!ArrayParser<int>("[1,2,3,4]").parse(std::span<int>(storage), count) && count == 0);
+    CHECK(!ArrayParser<int>("[1,oops]").parse(std::span<int>(storage), count) && count == 0);
+    CHECK(ArrayParser<int>("[1,2,3]").parse(std::span<int>(storage), count) && count == 3);
+}
+
+void testLongArrays() {
+    // Long enough for the SIMD comma count to matter
+    std::string json = "[";
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        if (i) json += ',';
+        json += std::to_string(i * 4099u);
+        expected.push_back(i * 4099u);
+    }
+    json += "]";
+    CHECK(parses<uint32_t>(json, expected));
+}
+
+} // namespace
+
+int main() {
+    testIntegerLimits();
+    testNumberGrammar();
+    testBools();
+    testStrings();
+    testStructure();
+    testFailureCleanup();
+    testLongArrays();
+    return Check::report("array_parser");
+}
@@ -0,0 +1,43 @@
+#ifndef CHECK_HPP
+#define CHECK_HPP
+
+// ✅ Minimal assertions for the parser tests - no framework to fetch or install.
+// Each test is its own executable: CHECK() records failures with file:line,
+// and main() returns Check::report(), which is non-zero if anything failed.
+
+#include <cstdio>
+
+#include "../cpu_dispatch.hpp"
+
+namespace Check {
+
+struct Counters {
+    int checks = 0;
+    int failures = 0;
+};
+
+inline Counters& counters() {
+    static Counters c;
+    return c;
+}
+
+inline bool record(bool ok, const char* expression, const char* file, int line) {
+    ++counters().checks;
+    if (!ok) {
+        ++counters().failures;
+        std::printf("❌ %s:%d: CHECK(%s)\n", file, line, expression);
+    }
+    return ok;
+}
+
+inline int report(const char* suite) {
+    std::printf("%s %s [%s]: %d checks, %d failed\n", counters().failures ? "❌" : "✅", suite,
+                CpuDispatch::describeSelection().c_str(), counters().checks, counters().failures);
+    return counters().failures == 0 ? 0 : 1;
+}
+
+} // namespace Check
+
+#define CHECK(expression) Check::record(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#endif // CHECK_HPP
@@ -0,0 +1,148 @@
+// On-demand reader: lazy field access, escape decoding, duplicate keys and
+// rejection of malformed objects
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "check.hpp"
+#include "ondemand.hpp"
+
+namespace {
+
+void testFields() {
+    std::string json = R"({"beacon_id":"lh-7","seq":42,"rate":12.5,"up":true,"down":false,"nested":{"a":[1,2]},"neg":-3})";
+    OnDemand::Document document;
+    CHECK(document.load(json));
+    CHECK(document.fieldCount() == 7);
+
+    // Out of wire order, and repeated
+    int64_t neg = 0;
+    CHECK(document.getNumber("neg", neg) && neg == -3);
+    std::string_view id;
+    CHECK(document.getString("beacon_id", id) && id == "lh-7");
+    CHECK(id.data() >= json.data() && id.data() < json.data() + json.size());   // clean strings are not copied
+    uint64_t seq = 0;
+    CHECK(document.getNumber("seq", seq) && seq == 42);
+    double rate = 0;
+    CHECK(document.getNumber("rate", rate) && rate == 12.5);
+    bool up = false;
+    bool down = true;
+    CHECK(document.getBool("up", up) && up);
+    CHECK(document.getBool("down", down) && !down);
+    CHECK(document.getString("beacon_id", id) && id == "lh-7");
+
+    // Wrong types and missing keys
+    CHECK(!document.getString("seq", id));
+    CHECK(!document.getBool("seq", up));
+    CHECK(!document.getNumber("beacon_id", seq));
+    CHECK(!document.getNumber("nested", seq));
+    CHECK(!document.has("missing"));
+    CHECK(document.has("nested"));
+
+    // Range limits come from from_chars
+    uint8_t small = 0;
+    CHECK(document.getNumber("seq", small) && small == 42);
+    CHECK(document.load(R"({"big":300,"neg":-1})"));
+    CHECK(!document.getNumber("big", small));
+    uint32_t unsigned_value = 0;
+    CHECK(!document.getNumber("neg", unsigned_value));
+}
+
+void testEscapes() {
+    std::string json = R"({"plain":"abc","esc":"a\"b\\c\né😀","key":"v","k\u0065y2":"w","bad":"\x"})";
+    OnDemand::Document document;
+    CHECK(document.load(json));
+
+    std::string_view text;
+    CHECK(document.getString("esc", text) && text == "a\"b\\c\n\xC3\xA9\xF0\x9F\x98\x80");
+    std::string_view again;
+    CHECK(document.getString("esc", again) && again.data() == text.data());   // decoded once
+    CHECK(document.getRawString("esc", text) && text == R"(a\"b\\c\né😀)");
+
+    // Keys are matched decoded
+    CHECK(document.getString("key", text) && text == "v");
+    CHECK(document.getString("key2", text) && text == "w");
+    CHECK(!document.has("k\\u0065y2"));
+
+    // A bad escape fails the read, not the load
+    CHECK(!document.getString("bad", text));
+    CHECK(document.getRawString("bad", text) && text == R"(\x)");
+    CHECK(document.getString("plain", text) && text == "abc");
+
+    // Lone surrogates are rejected
+    CHECK(document.load(R"({"s":"\ud83d"})"));
+    CHECK(!document.getString("s", text));
+    CHECK(document.load(R"({"s":"\ude00x"})"));
+    CHECK(!document.getString("s", text));
+
+    // A key that cannot be decoded makes the object invalid
+    CHECK(!document.load(R"({"\q":1})"));
+}
+
+void testDuplicateKeys() {
+    OnDemand::Document document;
+    CHECK(document.load(R"({"a":1,"b":2,"a":3,"c":4,"a":5})"));
+    CHECK(document.fieldCount() == 3);
+
+    // The first occurrence wins whatever was read before
+    int value = 0;
+    CHECK(document.getNumber("c", value) && value == 4);
+    CHECK(document.getNumber("a", value) && value == 1);
+    CHECK(document.getNumber("b", value) && value == 2);
+    CHECK(document.getNumber("a", value) && value == 1);
+
+    // Escaped and plain spellings of one key are the same key
+    CHECK(document.load(R"({"id":"first","\u0069d":"second"})"));
+    std::string_view text;
+    CHECK(document.fieldCount() == 1);
+    CHECK(document.getString("id", text) && text == "first");
+}
+
+void testMalformed() {
+    OnDemand::Document document;
+    const char* bad[] = {
+        "",
+        "[1,2]",
+        "{",
+        R"({"a":1)",
+        R"({"a":1,})",
+        R"({"a" 1})",
+        R"({"a":})",
+        R"({"a":1}})",
+        R"({"a":1} {"b":2})",
+        R"({"a":[1,2})",
+        R"({"a":"open})",
+        "{\"a\":\"\xC0\xAF\"}",   // overlong UTF-8
+    };
+    for (const char* json : bad) {
+        CHECK(!document.load(json));
+    }
+
+    CHECK(document.load("{}"));
+    CHECK(document.fieldCount() == 0);
+    CHECK(document.load(" { \"a\" : [ ] } "));
+    CHECK(document.has("a"));
+}
+
+void testReuse() {
+    OnDemand::Document document;
+    std::string_view text;
+    for (int round = 0; round < 3; ++round) {
+        std::string json = "{\"n\":" + std::to_string(round) + ",\"s\":\"x\\ty" + std::to_string(round) + "\"}";
+        CHECK(document.load(json));
+        int n = -1;
+        CHECK(document.getNumber("n", n) && n == round);
+        CHECK(document.getString("s", text) && text == "x\ty" + std::to_string(round));
+    }
+}
+
+} // namespace
+
+int main() {
+    testFields();
+    testEscapes();
+    testDuplicateKeys();
+    testMalformed();
+    testReuse();
+    return Check::report("ondemand");
+}
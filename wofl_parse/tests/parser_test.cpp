@@ -0,0 +1,177 @@
+// Parser<T>: reflected structs with nested members, every container mapping
+// (vector<bool> included), escapes, numeric range, and rejected input
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "check.hpp"
+#include "parser.hpp"
+
+namespace {
+
+struct Location {
+    std::string city;
+    double lat = 0;
+    double lon = 0;
+};
+
+struct Beacon {
+    std::string id;
+    uint32_t sequence = 0;
+    int8_t offset = 0;
+    bool healthy = false;
+    Location location;
+    std::vector<int> samples;
+    std::vector<bool> flags;
+    std::array<uint16_t, 3> ports{};
+    std::optional<std::string> note;
+    std::map<std::string, double> rates;
+    std::vector<Location> peers;
+};
+
+} // namespace
+
+template<>
+struct Reflector<Location> {
+    static constexpr auto fields = std::make_tuple(
+        std::make_pair("city", &Location::city),
+        std::make_pair("lat", &Location::lat),
+        std::make_pair("lon", &Location::lon)
+    );
+};
+
+template<>
+struct Reflector<Beacon> {
+    static constexpr auto fields = std::make_tuple(
+        std::make_pair("id", &Beacon::id),
+        std::make_pair("sequence", &Beacon::sequence),
+        std::make_pair("offset", &Beacon::offset),
+        std::make_pair("healthy", &Beacon::healthy),
+        std::make_pair("location", &Beacon::location),
+        std::make_pair("samples", &Beacon::samples),
+        std::make_pair("flags", &Beacon::flags),
+        std::make_pair("ports", &Beacon::ports),
+        std::make_pair("note", &Beacon::note),
+        std::make_pair("rates", &Beacon::rates),
+        std::make_pair("peers", &Beacon::peers)
+    );
+};
+
+namespace {
+
+template <typename T>
+bool parse(std::string_view json, T& out) {
+    Tokenizer tokenizer(json);
+    return Parser<T>(tokenizer).parse(out);
+}
+
+const char* full_beacon = R"({
+    "id": "lh-1\n",
+    "sequence": 4294967295,
+    "offset": -128,
+    "healthy": true,
+    "unknown": {"skipped": [1, {"deep": true}]},
+    "location": {"city": "Zürich", "lat": 47.37, "lon": 8.54},
+    "samples": [1, -2, 3],
+    "flags": [true, false, true],
+    "ports": [80, 443, 8080],
+    "note": "a \"quoted\" note",
+    "rates": {"in": 1.5, "out": 2e3},
+    "peers": [{"city": "Bern"}, {"lat": 1, "city": "Basel"}]
+})";
+
+void testReflectedStruct() {
+    Beacon beacon;
+    CHECK(parse(full_beacon, beacon));
+    CHECK(beacon.id == "lh-1\n");
+    CHECK(beacon.sequence == 4294967295u);
+    CHECK(beacon.offset == -128);
+    CHECK(beacon.healthy);
+    CHECK(beacon.location.city == "Z\xC3\xBCrich" && beacon.location.lat == 47.37 && beacon.location.lon == 8.54);
+    CHECK((beacon.samples == std::vector<int>{ 1, -2, 3 }));
+    CHECK((beacon.flags == std::vector<bool>{ true, false, true }));
+    CHECK((beacon.ports == std::array<uint16_t, 3>{ 80, 443, 8080 }));
+    CHECK(beacon.note && *beacon.note == "a \"quoted\" note");
+    CHECK(beacon.rates.size() == 2 && beacon.rates["in"] == 1.5 && beacon.rates["out"] == 2000.0);
+    CHECK(beacon.peers.size() == 2 && beacon.peers[0].city == "Bern" && beacon.peers[1].city == "Basel"
+          && beacon.peers[1].lat == 1.0);
+
+    // null resets an optional; containers are replaced, not appended to
+    CHECK(parse(R"({"note": null, "samples": [9], "flags": []})", beacon));
+    CHECK(!beacon.note);
+    CHECK((beacon.samples == std::vector<int>{ 9 }));
+    CHECK(beacon.flags.empty());
+}
+
+void testVectorOfBool() {
+    std::vector<bool> flags{ true };
+    CHECK(parse("[false, true, true, false]", flags));
+    CHECK((flags == std::vector<bool>{ false, true, true, false }));
+    CHECK(!parse("[true, 1]", flags));
+    CHECK(!parse("[true, null]", flags));
+
+    std::vector<std::vector<bool>> nested;
+    CHECK(parse("[[true], [], [false, false]]", nested));
+    CHECK(nested.size() == 3 && nested[0][0] && nested[1].empty() && nested[2].size() == 2);
+}
+
+void testRejected() {
+    const char* bad[] = {
+        R"({"sequence": 4294967296})",        // past uint32
+        R"({"sequence": -1})",
+        R"({"offset": 128})",                 // past int8
+        R"({"sequence": 1.5})",
+        R"({"sequence": 01})",                // not a JSON number
+        R"({"location": {"lat": 1.}})",
+        R"({"location": {"lat": .5}})",
+        R"({"sequence": "1"})",               // wrong types
+        R"({"healthy": 1})",
+        R"({"id": 5})",
+        R"({"samples": {}})",
+        R"({"location": []})",
+        R"({"ports": [1, 2]})",               // std::array needs its exact length
+        R"({"ports": [1, 2, 3, 4]})",
+        R"({"ports": [1, 2, 65536]})",
+        R"({"rates": {"in": "fast"}})",
+        R"({"id": "bad \x escape"})",
+        R"({"id": "unterminated)",
+        R"({"id": "a" "sequence": 1})",       // malformed structure
+        R"({"id": "a",})",
+        R"({"id" "a"})",
+        R"({"samples": [1 2]})",
+        R"({"samples": [1,]})",
+        R"({"unknown": [1, 2)",
+        R"({"sequence":12abc,"healthy":true})",  // junk glued to a number or literal
+        R"({"sequence":12,"healthy":truex})",
+        R"({"healthy": true false})",
+        "[]",
+    };
+    for (const char* json : bad) {
+        Beacon beacon;
+        if (!CHECK(!parse(json, beacon))) std::printf("     accepted: %s\n", json);
+    }
+}
+
+void testUntypedMap() {
+    std::unordered_map<std::string, std::string> fields;
+    CHECK(parse(R"({"a": "x\ty", "n": 12, "t": true, "z": null, "skip": [1, [2]], "o": {"k": 1}})", fields));
+    CHECK(fields["a"] == "x\ty" && fields["n"] == "12" && fields["t"] == "true" && fields["z"] == "null");
+    CHECK(fields.count("skip") == 0 && fields.count("o") == 0);
+    CHECK(!parse(R"({"a": })", fields));
+    CHECK(!parse(R"(["a"])", fields));
+}
+
+} // namespace
+
+int main() {
+    testReflectedStruct();
+    testVectorOfBool();
+    testRejected();
+    testUntypedMap();
+    return Check::report("parser");
+}
@@ -0,0 +1,124 @@
+// PathQuery: nested keys and array positions, typed access, duplicates,
+// skipping subtrees, early stop, and malformed input
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "check.hpp"
+#include "path_query.hpp"
+
+namespace {
+
+const char* document = R"({
+    "status": "ok",
+    "skip": {"status": "wrong", "list": [{"a": 1}, [2, 3]]},
+    "metadata": {"region": "eu-west", "zone": 3, "tags": ["x", "y\"z"]},
+    "data_sets": [{"enabled": false}, {"enabled": true, "rate": -2.5e2}],
+    "count": 18446744073709551615,
+    "big": 18446744073709551616,
+    "nil": null,
+    "quoted_number": "12"
+})";
+
+void testLookups() {
+    PathQuery::Query<"status", "metadata/region", "metadata/zone", "metadata/tags/1", "data_sets/1/enabled",
+                     "data_sets/1/rate", "count", "nil", "metadata/tags", "missing", "data_sets/5/enabled"> query;
+    CHECK(query.run(document));
+    CHECK(query.foundCount() == 9);
+
+    std::string_view text;
+    CHECK(query.get<"status">(text) && text == "ok");
+    CHECK(query.get<"metadata/region">(text) && text == "eu-west");
+    CHECK(query.get<"metadata/tags/1">(text) && text == R"(y\"z)");   // escapes as on the wire
+    CHECK(query.raw(query.indexOf<"metadata/tags">()) == R"(["x", "y\"z"])");
+
+    int zone = 0;
+    CHECK(query.get<"metadata/zone">(zone) && zone == 3);
+    bool enabled = false;
+    CHECK(query.get<"data_sets/1/enabled">(enabled) && enabled);
+    double rate = 0;
+    CHECK(query.get<"data_sets/1/rate">(rate) && rate == -250.0);
+    uint64_t count = 0;
+    CHECK(query.get<"count">(count) && count == 18446744073709551615ULL);
+
+    // Wrong type, missing, and out of range
+    CHECK(!query.get<"status">(zone));
+    CHECK(!query.get<"metadata/zone">(text));
+    CHECK(!query.get<"nil">(enabled));
+    CHECK(query.found(query.indexOf<"nil">()));
+    CHECK(!query.found(query.indexOf<"missing">()) && !query.get<"missing">(text));
+    CHECK(!query.found(query.indexOf<"data_sets/5/enabled">()));
+    uint8_t small = 0;
+    CHECK(query.get<"metadata/zone">(small) && small == 3);
+    CHECK(!query.get<"count">(small));
+}
+
+void testNumbersFollowTheGrammar() {
+    PathQuery::Query<"quoted_number", "big"> query;
+    CHECK(query.run(document));
+    int n = 0;
+    CHECK(!query.get<"quoted_number">(n));     // a string, even if it reads like a number
+    uint64_t big = 0;
+    CHECK(!query.get<"big">(big));
+    double as_double = 0;
+    CHECK(query.get<"big">(as_double) && as_double == 18446744073709551616.0);
+
+    PathQuery::Query<"a"> loose;
+    for (const char* json : { R"({"a": 01})", R"({"a": 1.})", R"({"a": -})" }) {
+        CHECK(loose.run(json));
+        CHECK(!loose.get<"a">(as_double));
+    }
+}
+
+void testDuplicatesAndReuse() {
+    PathQuery::Query<"id", "inner/id"> query;
+    CHECK(query.run(R"({"id": "first", "inner": {"id": 1, "id": 2}, "id": "second"})"));
+    std::string_view text;
+    int inner = 0;
+    CHECK(query.get<"id">(text) && text == "first");
+    CHECK(query.get<"inner/id">(inner) && inner == 1);
+
+    // Nothing carries over from the previous document
+    CHECK(query.run(R"({"inner": {"id": 7}})"));
+    CHECK(!query.found(0) && query.get<"inner/id">(inner) && inner == 7);
+}
+
+void testEarlyStopAndMalformed() {
+    PathQuery::Query<"a"> query;
+
+    // The walk stops once every path is found, and skipped subtrees are only
+    // bracket-counted; structure in neither is checked
+    CHECK(query.run(R"({"a": 1, "b": [1 2 3]})"));
+    CHECK(query.run(R"({"b": [1 2], "a": 1})") && query.found(0));
+    // ...but the whole input is indexed first, so invalid UTF-8 anywhere fails
+    CHECK(!query.run("{\"a\": 1, \"b\": \"\xC0\xAF\"}"));
+
+    // Malformed before the match, or with the path absent, fails
+    const char* bad[] = { R"({"b" 1, "a": 1})", R"({"b": 1)", R"({"b": {"c": 1})",
+                          R"({"b": 1,})", "", R"({"b": "open)" };
+    for (const char* json : bad) {
+        CHECK(!query.run(json));
+    }
+
+    // A document without the path is fine, and a scalar root has no paths in it
+    CHECK(query.run(R"({"b": {"a": 1}})") && !query.found(0));
+    CHECK(query.run(R"([1, 2])") && !query.found(0));
+    CHECK(query.run("42") && !query.found(0));
+
+    // Paths into arrays only match positions, and keys only match objects
+    PathQuery::Query<"0", "0/a"> positions;
+    CHECK(positions.run(R"([{"a": "yes"}])"));
+    std::string_view text;
+    CHECK(positions.get<"0/a">(text) && text == "yes");
+    CHECK(positions.run(R"({"0": {"a": "key"}})") && positions.get<"0/a">(text) && text == "key");
+}
+
+} // namespace
+
+int main() {
+    testLookups();
+    testNumbersFollowTheGrammar();
+    testDuplicatesAndReuse();
+    testEarlyStopAndMalformed();
+    return Check::report("path_query");
+}
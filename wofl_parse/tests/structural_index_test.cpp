@@ -0,0 +1,165 @@
+// Structural indexer: offsets, string/escape handling across block
+// boundaries, agreement between kernels, and the Tokenizer on top of it
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "check.hpp"
+#include "structural_index.hpp"
+#include "tokenizer.hpp"
+
+using StructuralIndex::Kernel;
+
+namespace {
+
+std::vector<Kernel> availableKernels() {
+    std::vector<Kernel> kernels{ Kernel::Scalar };
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::activeIsa() >= CpuDispatch::Isa::Sse2) kernels.push_back(Kernel::Sse2);
+        if (CpuDispatch::hasAvx2()) kernels.push_back(Kernel::Avx2);
+    #endif
+    return kernels;
+}
+
+std::vector<uint32_t> index(std::string_view json, Kernel kernel, bool* closed = nullptr) {
+    std::vector<uint32_t> out;
+    bool ok = StructuralIndex::build(json, out, kernel);
+    if (closed) *closed = ok;
+    return out;
+}
+
+void testOffsets() {
+    std::string json = R"({"a":1,"b":[true,null]})";
+    std::vector<uint32_t> expected{ 0, 1, 4, 5, 6, 7, 10, 11, 12, 16, 17, 21, 22 };
+    for (Kernel kernel : availableKernels()) {
+        bool closed = false;
+        CHECK(index(json, kernel, &closed) == expected);
+        CHECK(closed);
+    }
+}
+
+void testStringsHideStructurals() {
+    // Commas, colons and brackets inside strings - escaped quotes included - are not structural
+    std::string json = R"({"k":"a,b:[c]\"d}"})";
+    std::vector<uint32_t> expected{ 0, 1, 4, 5, 18 };
+    for (Kernel kernel : availableKernels()) {
+        CHECK(index(json, kernel) == expected);
+    }
+
+    // An even backslash run does not escape the quote that follows it
+    std::string even = R"(["x\\",1])";
+    std::vector<uint32_t> even_expected{ 0, 1, 6, 7, 8 };
+    for (Kernel kernel : availableKernels()) {
+        CHECK(index(even, kernel) == even_expected);
+    }
+}
+
+void testBlockBoundaries() {
+    // Put a backslash run ending exactly on every position around the 64-byte block edge
+    for (size_t pad = 50; pad < 80; ++pad) {
+        for (size_t run = 1; run <= 4; ++run) {
+            std::string json = "[\"" + std::string(pad, 'x') + std::string(run, '\\') + "\",1]";
+            // Odd runs escape the quote: the string is still open at the end
+            bool escaped = run % 2 == 1;
+            if (escaped) json += "\"]";
+
+            std::vector<uint32_t> reference = index(json, Kernel::Scalar);
+            for (Kernel kernel : availableKernels()) {
+                CHECK(index(json, kernel) == reference);
+            }
+            CHECK(reference.size() == (escaped ? 3u : 5u));
+        }
+    }
+}
+
+void testUnterminatedString() {
+    for (Kernel kernel : availableKernels()) {
+        bool closed = true;
+        index(R"({"a":"never closed)", kernel, &closed);
+        CHECK(!closed);
+        index(R"({"a":"closed"})", kernel, &closed);
+        CHECK(closed);
+    }
+}
+
+void testKernelsAgreeOnRandomInput() {
+    const std::string alphabet = "{}[]:,\"\\ \t\nabc123-.e";
+    std::mt19937 rng(12345);
+    for (int round = 0; round < 2000; ++round) {
+        std::string input(rng() % 300, ' ');
+        for (char& c : input) c = alphabet[rng() % alphabet.size()];
+
+        bool reference_closed = false;
+        std::vector<uint32_t> reference = index(input, Kernel::Scalar, &reference_closed);
+        for (Kernel kernel : availableKernels()) {
+            bool closed = false;
+            bool same = index(input, kernel, &closed) == reference && closed == reference_closed;
+            if (!CHECK(same)) return;
+        }
+    }
+}
+
+void testTokenizer() {
+    std::string json = R"( { "id" : "lh-1", "n" : -12.5e3, "ok" : true, "x" : null, "list" : [1, {"deep": []}], "z": false } )";
+    Tokenizer tokenizer(json);
+    std::vector<TokenType> types;
+    std::vector<std::string> values;
+    for (Token token = tokenizer.next(); token.type != TokenType::End; token = tokenizer.next()) {
+        types.push_back(token.type);
+        values.emplace_back(token.value);
+        if (token.type == TokenType::Unknown) break;
+    }
+
+    std::vector<TokenType> expected{
+        TokenType::ObjectStart,
+        TokenType::String, TokenType::Colon, TokenType::String, TokenType::Comma,
+        TokenType::String, TokenType::Colon, TokenType::Number, TokenType::Comma,
+        TokenType::String, TokenType::Colon, TokenType::True, TokenType::Comma,
+        TokenType::String, TokenType::Colon, TokenType::Null, TokenType::Comma,
+        TokenType::String, TokenType::Colon, TokenType::ArrayStart, TokenType::Number, TokenType::Comma,
+        TokenType::ObjectStart, TokenType::String, TokenType::Colon, TokenType::ArrayStart, TokenType::ArrayEnd,
+        TokenType::ObjectEnd, TokenType::ArrayEnd, TokenType::Comma,
+        TokenType::String, TokenType::Colon, TokenType::False,
+        TokenType::ObjectEnd
+    };
+    CHECK(types == expected);
+    CHECK(values.size() > 7 && values[1] == "id" && values[3] == "lh-1" && values[7] == "-12.5e3");
+
+    // skipContainer jumps over a nested value after its opening token
+    Tokenizer skipping(R"({"skip": {"a": [1, 2, {"b": 3}]}, "keep": 4})");
+    CHECK(skipping.next().type == TokenType::ObjectStart);
+    CHECK(skipping.next().value == "skip");
+    CHECK(skipping.next().type == TokenType::Colon);
+    CHECK(skipping.next().type == TokenType::ObjectStart);
+    CHECK(skipping.skipContainer());
+    CHECK(skipping.next().type == TokenType::Comma);
+    CHECK(skipping.next().value == "keep");
+
+    // Unbalanced: skipContainer runs out of input
+    Tokenizer unbalanced(R"({"a": [1, 2)");
+    unbalanced.next();
+    unbalanced.next();
+    unbalanced.next();
+    CHECK(unbalanced.next().type == TokenType::ArrayStart);
+    CHECK(!unbalanced.skipContainer());
+
+    // A string that never closes is Unknown, not a String
+    Tokenizer open_string(R"({"a": "oops)");
+    open_string.next();
+    open_string.next();
+    open_string.next();
+    CHECK(open_string.next().type == TokenType::Unknown);
+}
+
+} // namespace
+
+int main() {
+    testOffsets();
+    testStringsHideStructurals();
+    testBlockBoundaries();
+    testUnterminatedString();
+    testKernelsAgreeOnRandomInput();
+    testTokenizer();
+    return Check::report("structural_index");
+}
@@ -0,0 +1,197 @@
+// Tape DOM: building and walking documents, escape decoding, numeric
+// limits, error kinds and offsets, and reuse of one Document
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "check.hpp"
+#include "tape_dom.hpp"
+
+using ParseResult::ParseErrorKind;
+
+namespace {
+
+void testWalk() {
+    TapeDom::Document document;
+    std::string json = R"({"id":"lh-1","n":42,"x":-1.5,"ok":true,"no":false,"nil":null,
+                           "list":[1,"two",[3],{"four":4}],"empty":{},"none":[]})";
+    CHECK(document.load(json).ok());
+
+    TapeDom::Element root = document.root();
+    CHECK(root.isObject());
+    CHECK(root.size() == 9);
+
+    std::string_view text;
+    int64_t integer = 0;
+    double real = 0;
+    bool flag = false;
+    CHECK(root["id"].getString(text) && text == "lh-1");
+    CHECK(root["n"].getInt64(integer) && integer == 42);
+    CHECK(root["n"].getDouble(real) && real == 42.0);
+    CHECK(root["x"].getDouble(real) && real == -1.5);
+    CHECK(!root["x"].getInt64(integer));
+    CHECK(root["ok"].getBool(flag) && flag);
+    CHECK(root["no"].getBool(flag) && !flag);
+    CHECK(root["nil"].isNull());
+    CHECK(!root["missing"].exists());
+    CHECK(!root["id"].getInt64(integer));
+
+    TapeDom::Element list = root["list"];
+    CHECK(list.isArray() && list.size() == 4);
+    CHECK(list.at(1).getString(text) && text == "two");
+    CHECK(list.at(2).isArray() && list.at(2).at(0).getInt64(integer) && integer == 3);
+    CHECK(list.at(3)["four"].getInt64(integer) && integer == 4);
+    CHECK(!list.at(4).exists());
+    CHECK(root["empty"].isObject() && root["empty"].size() == 0);
+    CHECK(root["none"].isArray() && root["none"].size() == 0);
+
+    std::vector<std::string> keys;
+    root.forEachField([&](std::string_view key, TapeDom::Element) { keys.emplace_back(key); });
+    CHECK(keys.size() == 9 && keys.front() == "id" && keys.back() == "none");
+
+    int64_t sum = 0;
+    TapeDom::Document numbers;
+    CHECK(numbers.load("[1,2,3,4]").ok());
+    numbers.root().forEachElement([&](TapeDom::Element value) {
+        int64_t n = 0;
+        if (value.getInt64(n)) sum += n;
+    });
+    CHECK(sum == 10);
+
+    // Scalars at the top level, and duplicate keys: the first one wins
+    CHECK(document.load(" 7 ").ok() && document.root().getInt64(integer) && integer == 7);
+    CHECK(document.load(R"("just a string")").ok() && document.root().getString(text) && text == "just a string");
+    CHECK(document.load(R"({"a":1,"a":2})").ok() && document.root()["a"].getInt64(integer) && integer == 1);
+}
+
+void testEscapes() {
+    TapeDom::Document document;
+    CHECK(document.load(R"(["a\"b", "back\\slash", "\/\b\f\n\r\t", "é€", "😀", "café"])").ok());
+    TapeDom::Element list = document.root();
+    std::string_view text;
+    CHECK(list.at(0).getString(text) && text == "a\"b");
+    CHECK(list.at(1).getString(text) && text == "back\\slash");
+    CHECK(list.at(2).getString(text) && text == "/\b\f\n\r\t");
+    CHECK(list.at(3).getString(text) && text == "\xC3\xA9\xE2\x82\xAC");
+    CHECK(list.at(4).getString(text) && text == "\xF0\x9F\x98\x80");
+    CHECK(list.at(5).getString(text) && text == "caf\xC3\xA9");
+
+    // Keys are decoded too
+    CHECK(document.load(R"({"k\u0065y":1})").ok() && document.root()["key"].exists());
+
+    // Bad escapes point at the backslash
+    struct Case { const char* json; size_t offset; };
+    const Case bad[] = {
+        { R"(["\x"])", 2 },
+        { R"(["ab\u12"])", 4 },
+        { R"(["\ud83d"])", 2 },          // high surrogate alone
+        { R"(["\ud83dx\ude00"])", 2 },   // ...or not followed by an escape
+        { R"(["\ud83d\u0041"])", 2 },   // ...or by a non-surrogate
+        { R"(["\ude00"])", 2 },          // low surrogate first
+    };
+    for (const Case& c : bad) {
+        ParseResult::ParseOutcome outcome = document.load(c.json);
+        CHECK(outcome.kind == ParseErrorKind::Malformed && outcome.offset == c.offset);
+    }
+}
+
+void testNumericLimits() {
+    TapeDom::Document document;
+    int64_t integer = 0;
+    double real = 0;
+
+    CHECK(document.load("[9223372036854775807,-9223372036854775808]").ok());
+    CHECK(document.root().at(0).getInt64(integer) && integer == std::numeric_limits<int64_t>::max());
+    CHECK(document.root().at(1).getInt64(integer) && integer == std::numeric_limits<int64_t>::min());
+
+    // One past int64 becomes a double rather than failing
+    CHECK(document.load("[9223372036854775808,-9223372036854775809]").ok());
+    CHECK(!document.root().at(0).getInt64(integer));
+    CHECK(document.root().at(0).getDouble(real) && real == 9223372036854775808.0);
+    CHECK(document.root().at(1).getDouble(real) && real == -9223372036854775808.0);
+
+    CHECK(document.load("[1.7976931348623157e308,4.9e-324,-0.0,1E2,2e-2]").ok());
+    CHECK(document.root().at(0).getDouble(real) && real == std::numeric_limits<double>::max());
+    CHECK(document.root().at(1).getDouble(real) && real > 0 && real < 1e-323);
+    CHECK(document.root().at(3).getDouble(real) && real == 100.0);
+    CHECK(document.root().at(4).getDouble(real) && real == 0.02);
+
+    // Beyond double range, and things that are not numbers
+    const char* bad[] = { "[1e309]", "[-1e400]", "[+1]", "[.5]", "[-]", "[1e]", "[0x10]", "[1-2]", "[tru]", "[nul]" };
+    for (const char* json : bad) {
+        CHECK(document.load(json).kind == ParseErrorKind::Malformed);
+    }
+
+    // diagnose() holds numbers to the same grammar, not to what from_chars accepts
+    for (const char* json : { R"({"a":-inf})", "[01]", "[1.]", "[-]", "[nan]", "[1e5x]" }) {
+        CHECK(ParseResult::diagnose(json).kind == ParseErrorKind::Malformed);
+        CHECK(document.load(json).kind == ParseErrorKind::Malformed);
+    }
+    CHECK(ParseResult::diagnose("[-0.5e-3,1E+2,1e309]").ok());
+}
+
+void testErrors() {
+    TapeDom::Document document;
+    struct Case { std::string json; ParseErrorKind kind; size_t offset; };
+    const Case cases[] = {
+        { "", ParseErrorKind::Empty, 0 },
+        { "   ", ParseErrorKind::Empty, 0 },
+        { R"({"a":1)", ParseErrorKind::Truncated, 6 },
+        { R"({"a":"open)", ParseErrorKind::Truncated, 10 },
+        { R"([1,2)", ParseErrorKind::Truncated, 4 },
+        { R"({"a" 1})", ParseErrorKind::Malformed, 5 },
+        { R"({"a":1,})", ParseErrorKind::Malformed, 7 },
+        { R"([1,,2])", ParseErrorKind::Malformed, 3 },
+        { R"([1 2])", ParseErrorKind::Malformed, 3 },
+        { R"({1:2})", ParseErrorKind::Malformed, 1 },
+        { R"([1]])", ParseErrorKind::Malformed, 3 },
+        { R"({"a":1} {"b":2})", ParseErrorKind::Malformed, 8 },
+        { R"([1})", ParseErrorKind::Malformed, 2 },
+        { "[\"caf\xC3\x28\"]", ParseErrorKind::InvalidUtf8, 5 },
+    };
+    for (const Case& c : cases) {
+        ParseResult::ParseOutcome outcome = document.load(c.json);
+        bool ok = !outcome.ok() && outcome.kind == c.kind && outcome.offset == c.offset;
+        if (!CHECK(ok)) {
+            std::printf("     %s -> %s at %zu\n", c.json.c_str(), ParseResult::errorKindName(outcome.kind), outcome.offset);
+        }
+        // A failed load leaves nothing behind
+        CHECK(!document.root().exists() && document.tapeEntries() == 0 && document.stringBytes() == 0);
+    }
+}
+
+void testReuse() {
+    TapeDom::Document document;
+    std::string big = "{\"list\":[";
+    for (int i = 0; i < 500; ++i) {
+        if (i) big += ',';
+        big += "\"s" + std::to_string(i) + "\"";
+    }
+    big += "]}";
+    CHECK(document.load(big).ok());
+    CHECK(document.root()["list"].size() == 500);
+
+    // A smaller document after a bigger one sees none of it
+    CHECK(document.load(R"({"only":"one"})").ok());
+    std::string_view text;
+    CHECK(document.root().size() == 1 && document.root()["only"].getString(text) && text == "one");
+    CHECK(!document.root()["list"].exists());
+
+    // ...and a failure in between does not disturb the next load
+    CHECK(!document.load(R"({"broken":)").ok());
+    CHECK(document.load(R"([true])").ok() && document.root().size() == 1);
+}
+
+} // namespace
+
+int main() {
+    testWalk();
+    testEscapes();
+    testNumericLimits();
+    testErrors();
+    testReuse();
+    return Check::report("tape_dom");
+}
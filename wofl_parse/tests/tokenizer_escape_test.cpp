@@ -0,0 +1,181 @@
+// String escapes: JsonString decoding, the Tokenizer's view-or-arena strings,
+// bad escapes and raw control characters, and findSpecial against scalar
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "check.hpp"
+#include "json_string.hpp"
+#include "tape_dom.hpp"
+#include "tokenizer.hpp"
+
+namespace {
+
+bool unescapes(std::string_view raw, std::string_view expected) {
+    std::vector<char> out;
+    return JsonString::unescapeInto(raw, out) == raw.size() && std::string_view(out.data(), out.size()) == expected;
+}
+
+size_t badAt(std::string_view raw) {
+    std::vector<char> out;
+    return JsonString::unescapeInto(raw, out);
+}
+
+void testUnescape() {
+    CHECK(unescapes("", ""));
+    CHECK(unescapes("plain", "plain"));
+    CHECK(unescapes(R"(\"\\\/\b\f\n\r\t)", "\"\\/\b\f\n\r\t"));
+    CHECK(unescapes(R"(\u0041\u00e9\u20AC)", "A\xC3\xA9\xE2\x82\xAC"));
+    CHECK(unescapes(R"(\u0000)", std::string_view("\0", 1)));
+    CHECK(unescapes(R"(\ud83d\ude00)", "\xF0\x9F\x98\x80"));
+    CHECK(unescapes(R"(\uD800\uDC00)", "\xF0\x90\x80\x80"));      // U+10000
+    CHECK(unescapes(R"(\uDBFF\uDFFF)", "\xF4\x8F\xBF\xBF"));      // U+10FFFF
+    CHECK(unescapes(R"(a\nb\tc)", "a\nb\tc"));
+
+    // Offset of the first bad byte
+    CHECK(badAt(R"(\x)") == 0);
+    CHECK(badAt(R"(ab\)") == 2);
+    CHECK(badAt(R"(\u12)") == 0);
+    CHECK(badAt(R"(\u12G4)") == 0);
+    CHECK(badAt(R"(ok\ud83d)") == 2);
+    CHECK(badAt(R"(\ud83d\u0041)") == 0);
+    CHECK(badAt(R"(\ude00)") == 0);
+    CHECK(badAt("tab\there") == 3);
+    CHECK(badAt(std::string_view("nul\0", 4)) == 3);
+    CHECK(badAt("\x1F") == 0);
+    CHECK(badAt("del\x7F is fine") == 12);   // DEL is not a control character in JSON
+}
+
+void testEveryBmpEscape() {
+    // \uXXXX for every non-surrogate BMP code point decodes to its UTF-8 form
+    static const char hex[] = "0123456789abcdef";
+    bool all = true;
+    for (uint32_t cp = 0; cp <= 0xFFFF && all; ++cp) {
+        if (cp >= 0xD800 && cp <= 0xDFFF) continue;
+        std::string raw = "\\u";
+        for (int shift = 12; shift >= 0; shift -= 4) raw += hex[(cp >> shift) & 0xF];
+
+        std::vector<char> out;
+        if (JsonString::unescapeInto(raw, out) != raw.size()) {
+            all = false;
+            break;
+        }
+        std::vector<char> expected;
+        JsonString::detail::appendUtf8(expected, cp);
+        all = out == expected && Utf8::validate(std::string_view(out.data(), out.size()));
+    }
+    CHECK(all);
+}
+
+void testFindSpecial() {
+    CHECK(JsonString::findSpecial("") == 0);
+    CHECK(JsonString::findSpecial("no specials here") == 16);
+    CHECK(JsonString::findSpecial("a\\b") == 1);
+    CHECK(JsonString::findSpecial("ab\n") == 2);
+
+    // The vector scan and the scalar one agree, wherever the special byte falls
+    std::mt19937 rng(77);
+    for (int round = 0; round < 4000; ++round) {
+        std::string text(rng() % 200, 'x');
+        for (char& c : text) c = static_cast<char>(0x20 + rng() % 0x5F);
+        if (!text.empty() && rng() % 2) {
+            const char specials[] = { '\\', '\n', '\x01', '\x1F', '\0' };
+            text[rng() % text.size()] = specials[rng() % 5];
+        }
+        for (char& c : text) {
+            if (c == '\\' && rng() % 2) c = 'y';
+        }
+        if (!CHECK(JsonString::findSpecial(text) == JsonString::detail::findSpecialScalar(text, 0))) return;
+    }
+}
+
+void testTokenizerStrings() {
+    std::string json = R"(["clean", "esc\"aped", "tab\tnew\nline", "😀 \ud83d\ude00", ""])";
+    Tokenizer tokenizer(json);
+    CHECK(tokenizer.next().type == TokenType::ArrayStart);
+
+    std::vector<std::string_view> strings;
+    for (Token token = tokenizer.next(); token.type != TokenType::End; token = tokenizer.next()) {
+        if (token.type == TokenType::String) strings.push_back(token.value);
+        if (token.type == TokenType::Unknown) break;
+    }
+    CHECK(strings.size() == 5);
+    if (strings.size() != 5) return;
+
+    // Clean strings are views into the input; decoded ones are not
+    auto in_input = [&](std::string_view view) {
+        return view.data() >= json.data() && view.data() + view.size() <= json.data() + json.size();
+    };
+    CHECK(strings[0] == "clean" && in_input(strings[0]));
+    CHECK(strings[1] == "esc\"aped" && !in_input(strings[1]));
+    CHECK(strings[2] == "tab\tnew\nline");
+    CHECK(strings[3] == "\xF0\x9F\x98\x80 \xF0\x9F\x98\x80");
+    CHECK(strings[4].empty());
+
+    // Every decoded view stays valid while later strings are decoded
+    std::string many = "[";
+    for (int i = 0; i < 300; ++i) {
+        if (i) many += ',';
+        many += "\"s\\n" + std::to_string(i) + "\"";
+    }
+    many += "]";
+    Tokenizer many_tokens(many);
+    std::vector<std::string_view> views;
+    for (Token token = many_tokens.next(); token.type != TokenType::End; token = many_tokens.next()) {
+        if (token.type == TokenType::String) views.push_back(token.value);
+    }
+    bool intact = views.size() == 300;
+    for (size_t i = 0; intact && i < views.size(); ++i) intact = views[i] == "s\n" + std::to_string(i);
+    CHECK(intact);
+}
+
+void testTokenizerRejects() {
+    const char* bad[] = {
+        R"(["\x"])",
+        R"(["\u12"])",
+        R"(["\ud83d"])",
+        R"(["\ude00"])",
+        "[\"raw\ttab\"]",
+        "[\"raw\nnewline\"]",
+        R"(["trailing\"])",
+    };
+    for (const char* json : bad) {
+        Tokenizer tokenizer(json);
+        CHECK(tokenizer.next().type == TokenType::ArrayStart);
+        CHECK(tokenizer.next().type == TokenType::Unknown);
+    }
+
+    // Invalid UTF-8 anywhere stops the tokenizer at once
+    Tokenizer invalid("[\"fine\", \"\xED\xA0\x80\"]");
+    CHECK(invalid.invalidUtf8());
+    CHECK(invalid.next().type == TokenType::Unknown);
+
+    // The tape DOM rejects the same strings, at the offending byte
+    TapeDom::Document document;
+    ParseResult::ParseOutcome outcome = document.load("[\"ok\", \"raw\ttab\"]");
+    CHECK(outcome.kind == ParseResult::ParseErrorKind::Malformed && outcome.offset == 11);
+    outcome = document.load("{\"k\\u0000ey\": \"\\u0000\"}");
+    CHECK(outcome.ok());
+
+    // An escaped NUL is fine in keys and values; the length prefix keeps it
+    size_t fields = 0;
+    document.root().forEachField([&](std::string_view key, TapeDom::Element value) {
+        std::string_view text;
+        CHECK(key == std::string_view("k\0ey", 4));
+        CHECK(value.getString(text) && text == std::string_view("\0", 1));
+        ++fields;
+    });
+    CHECK(fields == 1);
+}
+
+} // namespace
+
+int main() {
+    testUnescape();
+    testEveryBmpEscape();
+    testFindSpecial();
+    testTokenizerStrings();
+    testTokenizerRejects();
+    return Check::report("tokenizer_escape");
+}
@@ -0,0 +1,154 @@
+// UTF-8 validation: the scalar decoder and the AVX2 lookup kernel on valid
+// text, every class of invalid sequence, sequences cut at block edges, and a
+// randomized comparison - plus the indexer's fused validation
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "check.hpp"
+#include "structural_index.hpp"
+#include "utf8_validate.hpp"
+
+namespace {
+
+// Every way to run the check, so each case is asked of each kernel
+bool validEverywhere(std::string_view text, bool expected) {
+    bool ok = (Utf8::detail::firstInvalidScalar(text) == text.size()) == expected;
+    ok = ok && Utf8::validate(text) == expected;
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) ok = ok && Utf8::detail::validateAvx2(text) == expected;
+    #endif
+    return ok;
+}
+
+const char* valid_cases[] = {
+    "",
+    "plain ascii",
+    "\xC2\x80",                 // U+0080, smallest two-byte
+    "\xDF\xBF",                 // U+07FF
+    "\xE0\xA0\x80",             // U+0800, smallest three-byte
+    "\xED\x9F\xBF",             // U+D7FF, just below the surrogates
+    "\xEE\x80\x80",             // U+E000, just above them
+    "\xEF\xBF\xBF",             // U+FFFF
+    "\xF0\x90\x80\x80",         // U+10000, smallest four-byte
+    "\xF4\x8F\xBF\xBF",         // U+10FFFF, the largest code point
+    "caf\xC3\xA9 \xF0\x9F\x98\x80 \xE2\x82\xAC",
+};
+
+const char* invalid_cases[] = {
+    "\x80",                     // lone continuation
+    "a\xBF",
+    "\xC0\x80",                 // overlong two-byte
+    "\xC1\xBF",
+    "\xE0\x80\x80",             // overlong three-byte
+    "\xE0\x9F\xBF",
+    "\xF0\x80\x80\x80",         // overlong four-byte
+    "\xF0\x8F\xBF\xBF",
+    "\xED\xA0\x80",             // U+D800, a surrogate
+    "\xED\xBF\xBF",             // U+DFFF
+    "\xF4\x90\x80\x80",         // U+110000, past the last code point
+    "\xF5\x80\x80\x80",
+    "\xFF",
+    "\xFE",
+    "\xC3",                     // truncated
+    "\xE2\x82",
+    "\xF0\x9F\x98",
+    "\xC3\x28",                 // lead byte followed by ASCII
+    "\xE2\x28\xA1",
+    "\xF0\x9F\x28\x80",
+    "\xC3\xA9\xA9",             // one continuation too many
+};
+
+void testFixedCases() {
+    for (const char* text : valid_cases) {
+        CHECK(validEverywhere(text, true));
+    }
+    for (const char* text : invalid_cases) {
+        CHECK(validEverywhere(text, false));
+    }
+}
+
+void testFirstInvalid() {
+    std::string text = "ok \xC3\xA9 then \xED\xA0\x80 bad";
+    CHECK(Utf8::firstInvalid(text) == 11);
+    CHECK(Utf8::firstInvalid("fine") == 4);
+}
+
+void testBlockEdges() {
+    // Start a multi-byte sequence on every offset around the 32- and 64-byte
+    // lane edges; whole it is valid, cut short at the end of input it is not
+    const std::string sequences[] = { "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+    for (const std::string& sequence : sequences) {
+        for (size_t pad = 24; pad < 72; ++pad) {
+            std::string whole = std::string(pad, 'x') + sequence + "tail";
+            CHECK(validEverywhere(whole, true));
+
+            for (size_t keep = 1; keep < sequence.size(); ++keep) {
+                std::string cut = std::string(pad, 'x') + sequence.substr(0, keep);
+                CHECK(validEverywhere(cut, false));
+                CHECK(Utf8::firstInvalid(cut) == pad);
+            }
+
+            // A bad byte in the second lane of a block
+            std::string bad = std::string(pad, 'x') + "\xC0\xAF" + std::string(70, 'y');
+            CHECK(validEverywhere(bad, false));
+        }
+    }
+}
+
+void testKernelsAgreeOnRandomInput() {
+    // Mostly well-formed text with occasional damage, so both answers come up
+    const std::string pieces[] = { "a", "{", "\"", " ", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80",
+                                   "\xED\x9F\xBF", "\xF4\x8F\xBF\xBF" };
+    std::mt19937 rng(2024);
+    int invalid_seen = 0;
+    for (int round = 0; round < 3000; ++round) {
+        std::string text;
+        size_t count = rng() % 120;
+        for (size_t i = 0; i < count; ++i) text += pieces[rng() % std::size(pieces)];
+        if (!text.empty() && rng() % 3 == 0) text[rng() % text.size()] = static_cast<char>(rng() & 0xFF);
+
+        bool expected = Utf8::detail::firstInvalidScalar(text) == text.size();
+        if (!expected) ++invalid_seen;
+        if (!CHECK(validEverywhere(text, expected))) return;
+
+        bool utf8_valid = !expected;
+        std::vector<uint32_t> fused;
+        std::vector<uint32_t> plain;
+        bool fused_closed = StructuralIndex::buildValidated(text, fused, utf8_valid);
+        bool plain_closed = StructuralIndex::build(text, plain);
+        if (!CHECK(utf8_valid == expected && fused == plain && fused_closed == plain_closed)) return;
+    }
+    CHECK(invalid_seen > 100);
+}
+
+void testBuildValidated() {
+    std::vector<uint32_t> out;
+    bool utf8_valid = false;
+    CHECK(StructuralIndex::buildValidated("{\"name\":\"caf\xC3\xA9\"}", out, utf8_valid));
+    CHECK(utf8_valid);
+    CHECK(out.size() == 5);
+
+    // Invalid bytes inside a string still fail validation; the index is unaffected
+    std::string bad = "{\"name\":\"caf\xC3\x28\"}";
+    CHECK(StructuralIndex::buildValidated(bad, out, utf8_valid));
+    CHECK(!utf8_valid);
+    CHECK(out.size() == 5);
+
+    // Past one block, with the bad byte in the second
+    std::string long_bad = "{\"k\":\"" + std::string(100, 'x') + "\xED\xA0\x80\"}";
+    CHECK(StructuralIndex::buildValidated(long_bad, out, utf8_valid));
+    CHECK(!utf8_valid);
+}
+
+} // namespace
+
+int main() {
+    testFixedCases();
+    testFirstInvalid();
+    testBlockEdges();
+    testKernelsAgreeOnRandomInput();
+    testBuildValidated();
+    return Check::report("utf8_validate");
+}
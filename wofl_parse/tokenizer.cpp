@@ -1,38 +1,140 @@
 #include "tokenizer.hpp"
+#include "structural_index.hpp"
+#include "json_string.hpp"
 #include <cctype>
 
-Tokenizer::Tokenizer(const std::string& input) : src(input) {}
+Tokenizer::Tokenizer(std::string_view input) {
+    bool utf8_valid = true;
+    unterminated_string = !StructuralIndex::buildValidated(input, structurals, utf8_valid);
+    if (!utf8_valid) {
+        invalid_utf8 = true;
+        structurals.clear();
+        return;
+    }
+    src = input;
+}
 
 void Tokenizer::skipWhitespace() {
-    while (pos < src.size() && isspace(src[pos])) {
+    while (pos < src.size() && isspace(static_cast<unsigned char>(src[pos]))) {
         ++pos;
     }
 }
 
 Token Tokenizer::next() {
-    skipWhitespace();
-    if (pos >= src.size()) return {TokenType::Unknown, ""};
+    if (invalid_utf8) return {TokenType::Unknown, ""};
+    if (cursor >= structurals.size()) {
+        pos = src.size();
+        return {TokenType::End, ""};
+    }
+    pos = structurals[cursor++];
 
-    if (src[pos] == '{') {
-        ++pos;
-        return {TokenType::ObjectStart, "{"};
+    Token scalar{};
+    switch (src[pos]) {
+        case '{': ++pos; return {TokenType::ObjectStart, "{"};
+        case '}': ++pos; return {TokenType::ObjectEnd, "}"};
+        case '[': ++pos; return {TokenType::ArrayStart, "["};
+        case ']': ++pos; return {TokenType::ArrayEnd, "]"};
+        case ':': ++pos; return {TokenType::Colon, ":"};
+        case ',': ++pos; return {TokenType::Comma, ","};
+        case '"': return parseString();
+        case 't':
+        case 'f':
+        case 'n': scalar = parseLiteral(); break;
+        default:
+            if (src[pos] != '-' && !isdigit(static_cast<unsigned char>(src[pos]))) {
+                return {TokenType::Unknown, src.substr(pos++, 1)};
+            }
+            scalar = parseNumber();
+            break;
     }
-    if (src[pos] == '}') {
-        ++pos;
-        return {TokenType::ObjectEnd, "}"};
+
+    if (scalar.type == TokenType::Unknown) return scalar;
+
+    // Jumping structural to structural never looks at what follows a number
+    // or literal, so check here that only whitespace does ("12abc", "truex")
+    size_t limit = cursor < structurals.size() ? structurals[cursor] : src.size();
+    for (size_t i = pos; i < limit; ++i) {
+        char c = src[i];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            pos = i + 1;
+            return {TokenType::Unknown, src.substr(i, 1)};
+        }
     }
-    if (src[pos] == '"') {
-        return parseString();
+    return scalar;
+}
+
+Token Tokenizer::parseString() {
+    size_t start = pos + 1;  // Skip opening quote
+    bool last = cursor >= structurals.size();
+    if (last && unterminated_string) {
+        pos = src.size();
+        return {TokenType::Unknown, "\""};
     }
 
-    return {TokenType::Unknown, std::string(1, src[pos++])};
+    std::string_view raw;
+    if (!StructuralIndex::stringAt(src, structurals, cursor - 1, raw)) {
+        pos = src.size();
+        return {TokenType::Unknown, "\""};
+    }
+
+    pos = start + raw.size() + 1;  // Skip closing quote
+    if (JsonString::findSpecial(raw) == raw.size()) return {TokenType::String, raw};
+
+    // Decoded text is never longer than its escaped form, so an arena sized to
+    // the whole input holds every string and earlier views stay valid
+    if (arena.capacity() < src.size()) arena.reserve(src.size());
+    size_t offset = arena.size();
+    if (JsonString::unescapeInto(raw, arena) != raw.size()) {
+        arena.resize(offset);
+        return {TokenType::Unknown, "\""};
+    }
+    return {TokenType::String, std::string_view(arena.data() + offset, arena.size() - offset)};
 }
 
-Token Tokenizer::parseString() {
-    ++pos;  // Skip opening quote
+Token Tokenizer::parseNumber() {
     size_t start = pos;
-    while (pos < src.size() && src[pos] != '"') ++pos;
-    std::string str = src.substr(start, pos - start);
-    ++pos;  // Skip closing quote
-    return {TokenType::String, str};
+    while (pos < src.size()) {
+        char c = src[pos];
+        if (!isdigit(static_cast<unsigned char>(c)) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') break;
+        ++pos;
+    }
+    return {TokenType::Number, src.substr(start, pos - start)};
+}
+
+Token Tokenizer::parseLiteral() {
+    std::string_view rest = src.substr(pos);
+    if (rest.substr(0, 4) == "true") {
+        pos += 4;
+        return {TokenType::True, "true"};
+    }
+    if (rest.substr(0, 5) == "false") {
+        pos += 5;
+        return {TokenType::False, "false"};
+    }
+    if (rest.substr(0, 4) == "null") {
+        pos += 4;
+        return {TokenType::Null, "null"};
+    }
+    return {TokenType::Unknown, src.substr(pos++, 1)};
+}
+
+bool Tokenizer::skipContainer() {
+    size_t depth = 1;
+    while (cursor < structurals.size()) {
+        size_t at = structurals[cursor++];
+        switch (src[at]) {
+            case '{':
+            case '[': ++depth; break;
+            case '}':
+            case ']':
+                if (--depth == 0) {
+                    pos = at + 1;
+                    return true;
+                }
+                break;
+            default: break;
+        }
+    }
+    pos = src.size();
+    return false;
 }
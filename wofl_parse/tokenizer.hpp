@@ -0,0 +1,63 @@
+#ifndef TOKENIZER_HPP
+#define TOKENIZER_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+enum class TokenType {
+    ObjectStart,
+    ObjectEnd,
+    ArrayStart,
+    ArrayEnd,
+    Colon,
+    Comma,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    End,
+    Unknown
+};
+
+// value is a view: into the input for numbers, literals and strings without
+// escapes, into the tokenizer's arena for decoded strings. It stays valid
+// for as long as both the tokenizer and the input do.
+struct Token {
+    TokenType type;
+    std::string_view value;
+};
+
+// Builds a structural index of the input up front (see structural_index.hpp)
+// and then hops from structural to structural instead of scanning bytes.
+// Input that is not valid UTF-8 is rejected in the same pass, and next()
+// returns Unknown straight away. The input is not copied: it must outlive
+// the tokenizer. String escapes are decoded; a bad escape or a raw control
+// character makes the string Unknown.
+class Tokenizer {
+public:
+    Tokenizer(std::string_view input);
+    Token next();
+    void skipWhitespace();
+    Token parseString();
+    Token parseNumber();
+    Token parseLiteral();
+
+    // Skips the rest of an object/array whose opening token was just consumed.
+    // Only brackets are matched; skipped content is not validated.
+    bool skipContainer();
+
+    bool invalidUtf8() const { return invalid_utf8; }
+
+private:
+    std::string_view src;
+    std::vector<uint32_t> structurals;
+    std::vector<char> arena;            // decoded strings; never reallocates, see parseString
+    size_t cursor = 0;                  // next entry in structurals
+    bool unterminated_string = false;   // input ends inside a string
+    bool invalid_utf8 = false;
+    size_t pos = 0;
+};
+
+#endif
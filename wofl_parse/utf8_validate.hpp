@@ -0,0 +1,252 @@
+#ifndef UTF8_VALIDATE_HPP
+#define UTF8_VALIDATE_HPP
+
+// 🔤 UTF-8 validation
+// AVX2: the Keiser-Lemire lookup algorithm. Three 16-entry nibble tables
+// classify every (previous byte, byte) pair at once: overlong forms,
+// surrogates, values past U+10FFFF, stray or missing continuation bytes.
+// A 64-byte block that is all ASCII skips the tables entirely. The state
+// is kept between blocks, so the structural indexer can feed it the same
+// registers it already loaded (see StructuralIndex::buildValidated).
+// Other hosts: a scalar decoder that skips ASCII eight bytes at a time.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "cpu_dispatch.hpp"
+
+namespace Utf8 {
+
+namespace detail {
+
+// Offset of the first invalid byte, or input.size() when the whole input is valid
+inline size_t firstInvalidScalar(std::string_view input) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(input.data());
+    size_t size = input.size();
+    size_t i = 0;
+    while (i < size) {
+        // ASCII fast path, eight bytes at a time
+        if (i + 8 <= size) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            if ((word & 0x8080808080808080ULL) == 0) {
+                i += 8;
+                continue;
+            }
+        }
+
+        unsigned char lead = bytes[i];
+        if (lead < 0x80) {
+            ++i;
+            continue;
+        }
+
+        size_t length = 0;
+        uint32_t code_point = 0;
+        if ((lead & 0xE0) == 0xC0) { length = 2; code_point = lead & 0x1F; }
+        else if ((lead & 0xF0) == 0xE0) { length = 3; code_point = lead & 0x0F; }
+        else if ((lead & 0xF8) == 0xF0) { length = 4; code_point = lead & 0x07; }
+        else return i;
+
+        if (i + length > size) return i;
+        for (size_t k = 1; k < length; ++k) {
+            if ((bytes[i + k] & 0xC0) != 0x80) return i;
+            code_point = (code_point << 6) | (bytes[i + k] & 0x3F);
+        }
+
+        // Overlong forms, UTF-16 surrogates and values past U+10FFFF
+        static constexpr uint32_t min_for_length[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if (code_point < min_for_length[length] || code_point > 0x10FFFF
+            || (code_point >= 0xD800 && code_point <= 0xDFFF)) {
+            return i;
+        }
+        i += length;
+    }
+    return size;
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// Error bits, named for the (previous byte, byte) pattern that sets them
+constexpr uint8_t too_short = 1 << 0;    // 11______ 0_______ or 11______ 11______
+constexpr uint8_t too_long = 1 << 1;     // 0_______ 10______
+constexpr uint8_t overlong_3 = 1 << 2;   // 11100000 100_____
+constexpr uint8_t too_large = 1 << 3;    // 11110100 1001____ and above
+constexpr uint8_t surrogate = 1 << 4;    // 11101101 101_____
+constexpr uint8_t overlong_2 = 1 << 5;   // 1100000_ 10______
+constexpr uint8_t too_large_1000 = 1 << 6;   // 11110101 1000____ and above
+constexpr uint8_t overlong_4 = 1 << 6;   // 11110000 1000____
+constexpr uint8_t two_conts = 1 << 7;    // 10______ 10______
+constexpr uint8_t carry = too_short | too_long | two_conts;
+
+struct Avx2State {
+    __m256i error;
+    __m256i prev_input;        // last 32 bytes checked
+    __m256i prev_incomplete;   // non-zero if prev_input ends mid-sequence
+};
+
+CPU_DISPATCH_TARGET_AVX2 inline void avx2Begin(Avx2State& state) {
+    state.error = _mm256_setzero_si256();
+    state.prev_input = _mm256_setzero_si256();
+    state.prev_incomplete = _mm256_setzero_si256();
+}
+
+// The 16-entry table repeated in both 128-bit lanes, indexed by each byte of nibbles
+CPU_DISPATCH_TARGET_AVX2 inline __m256i lookup16(__m256i nibbles,
+    uint8_t t0, uint8_t t1, uint8_t t2, uint8_t t3, uint8_t t4, uint8_t t5, uint8_t t6, uint8_t t7,
+    uint8_t t8, uint8_t t9, uint8_t t10, uint8_t t11, uint8_t t12, uint8_t t13, uint8_t t14, uint8_t t15) {
+    __m256i table = _mm256_setr_epi8(
+        t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15,
+        t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15);
+    return _mm256_shuffle_epi8(table, nibbles);
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline __m256i highNibbles(__m256i bytes) {
+    return _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F));
+}
+
+// The input shifted right by N bytes, with the gap filled from the end of prev
+template <int N>
+CPU_DISPATCH_TARGET_AVX2 inline __m256i previous(__m256i input, __m256i prev) {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline __m256i checkSpecialCases(__m256i input, __m256i prev1) {
+    __m256i byte_1_high = lookup16(highNibbles(prev1),
+        // 0_______ ASCII
+        too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+        // 10______ continuation
+        two_conts, two_conts, two_conts, two_conts,
+        // 1100____, 1101____ two-byte lead
+        too_short | overlong_2,
+        too_short,
+        // 1110____ three-byte lead
+        too_short | overlong_3 | surrogate,
+        // 1111____ four-byte lead
+        too_short | too_large | too_large_1000 | overlong_4);
+
+    __m256i byte_1_low = lookup16(_mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)),
+        carry | overlong_3 | overlong_2 | overlong_4,           // ____0000
+        carry | overlong_2,                                     // ____0001
+        carry,                                                  // ____001_
+        carry,
+        carry | too_large,                                      // ____0100
+        carry | too_large | too_large_1000,                     // ____0101
+        carry | too_large | too_large_1000,                     // ____011_
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,                     // ____1___
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,         // ____1101
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000);
+
+    __m256i byte_2_high = lookup16(highNibbles(input),
+        // 0_______ ASCII
+        too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+        // 1000____
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+        // 1001____
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        // 101_____
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        // 11______ lead
+        too_short, too_short, too_short, too_short);
+
+    return _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+}
+
+// Third and fourth bytes of a sequence must be continuations; the special cases
+// flagged them as two_conts, so XOR clears the expected ones and leaves the rest
+CPU_DISPATCH_TARGET_AVX2 inline __m256i checkMultibyteLengths(__m256i input, __m256i prev, __m256i special) {
+    __m256i prev2 = previous<2>(input, prev);
+    __m256i prev3 = previous<3>(input, prev);
+    __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                                    _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(must_be_continuation, special);
+}
+
+// Non-zero if the last three bytes start a sequence that needs more bytes
+CPU_DISPATCH_TARGET_AVX2 inline __m256i isIncomplete(__m256i input) {
+    __m256i max_value = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+    return _mm256_subs_epu8(input, max_value);
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline void avx2CheckLane(Avx2State& state, __m256i input) {
+    __m256i special = checkSpecialCases(input, previous<1>(input, state.prev_input));
+    state.error = _mm256_or_si256(state.error, checkMultibyteLengths(input, state.prev_input, special));
+    state.prev_incomplete = isIncomplete(input);
+    state.prev_input = input;
+}
+
+// One 64-byte block, already loaded as two 32-byte lanes
+CPU_DISPATCH_TARGET_AVX2 inline void avx2CheckBlock(Avx2State& state, __m256i low, __m256i high) {
+    if (_mm256_movemask_epi8(_mm256_or_si256(low, high)) == 0) {
+        // All ASCII: only a sequence left open by the previous block can be wrong
+        state.error = _mm256_or_si256(state.error, state.prev_incomplete);
+        state.prev_incomplete = _mm256_setzero_si256();
+        state.prev_input = high;
+        return;
+    }
+    avx2CheckLane(state, low);
+    avx2CheckLane(state, high);
+}
+
+// Call after the last block
+CPU_DISPATCH_TARGET_AVX2 inline bool avx2Finish(Avx2State& state) {
+    __m256i error = _mm256_or_si256(state.error, state.prev_incomplete);
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+CPU_DISPATCH_TARGET_AVX2 inline bool validateAvx2(std::string_view input) {
+    Avx2State state;
+    avx2Begin(state);
+
+    size_t base = 0;
+    for (; base + 64 <= input.size(); base += 64) {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + base));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + base + 32));
+        avx2CheckBlock(state, low, high);
+    }
+    if (base < input.size()) {
+        // Pad with ASCII; an open sequence then fails on the padding
+        alignas(32) char tail[64];
+        std::memset(tail, ' ', sizeof(tail));
+        std::memcpy(tail, input.data() + base, input.size() - base);
+        avx2CheckBlock(state, _mm256_load_si256(reinterpret_cast<const __m256i*>(tail)),
+                       _mm256_load_si256(reinterpret_cast<const __m256i*>(tail + 32)));
+    }
+    return avx2Finish(state);
+}
+
+#endif // CPU_DISPATCH_X86
+
+} // namespace detail
+
+inline bool validate(std::string_view input) {
+    #ifdef CPU_DISPATCH_X86
+        if (CpuDispatch::hasAvx2()) return detail::validateAvx2(input);
+    #endif
+    return detail::firstInvalidScalar(input) == input.size();
+}
+
+// Offset of the first invalid byte, or input.size() when valid. For error
+// reports: the vector check answers yes/no, the scalar pass finds the byte.
+inline size_t firstInvalid(std::string_view input) {
+    if (validate(input)) return input.size();
+    return detail::firstInvalidScalar(input);
+}
+
+} // namespace Utf8
+
+#endif // UTF8_VALIDATE_HPP